@@ -0,0 +1,182 @@
+# makeReader.py
+#
+# Write the leaf list of NanoReader (src/NanoSchema.h) for the branches of a
+# sample file that match a set of patterns, with their types and the largest
+# counts found in the file. Optionally also write a minimal analysis class
+# deriving from NanoReader, like MakeClass would, but without the other
+# branches of the file.
+#
+#   python python/makeReader.py <sample.root> "LowPtElectron_*" "GenPart_*" -o src/NanoSchema.h
+#   python python/makeReader.py <sample.root> "Muon_*" --class MuonStudy
+#
+# The leaves used by NanoReader itself (event IDs, the LowPtElectron counter,
+# eta and convVeto) are always written, and the counter of every matched
+# array. Without patterns, the branches of the current schema are used. All
+# classes share the schema: the patterns cover the branches of every class.
+
+import os
+import sys
+import fnmatch
+import argparse
+import ROOT
+# Make sure ROOT.TFile.Open(fileURL) does not seg fault when $ is in sys.argv (e.g. $ passed in as argument)
+ROOT.PyConfig.IgnoreCommandLineOptions = True
+
+# branches of src/NanoSchema.h as committed
+default_patterns = ["run", "luminosityBlock", "event", "nGenPart", "GenPart_*", "nLowPtElectron", "LowPtElectron_*"]
+# branches NanoReader.h reads itself (Cut(), Preselections(), the cache)
+required = ["run", "luminosityBlock", "event", "nLowPtElectron", "LowPtElectron_eta", "LowPtElectron_convVeto"]
+
+# collect the leaves of tree matching patterns: list of (type, name, capacity, collection)
+def getLeaves(tree, patterns):
+    names = [b.GetName() for b in tree.GetListOfBranches()]
+    selected = set(required)
+    for pattern in patterns:
+        matched = fnmatch.filter(names, pattern)
+        if not matched:
+            print("WARNING: makeReader: no branch matches '{0}'.".format(pattern))
+        selected.update(matched)
+
+    # counters of the selected arrays
+    for name in list(selected):
+        leaf = tree.GetLeaf(name)
+        if leaf and leaf.GetLeafCount():
+            selected.add(leaf.GetLeafCount().GetName())
+
+    # counters name their collection
+    counters = set()
+    for leaf in tree.GetListOfLeaves():
+        if leaf.GetLeafCount():
+            counters.add(leaf.GetLeafCount().GetName())
+
+    leaves = []
+    for name in names:
+        if name not in selected:
+            continue
+        leaf = tree.GetLeaf(name)
+        if not leaf:
+            print("WARNING: makeReader: {0} has no leaf of the same name, skipped.".format(name))
+            continue
+        count    = leaf.GetLeafCount()
+        capacity = leaf.GetLenStatic() * (max(count.GetMaximum(), 1) if count else 1)
+        if count:
+            collection = count.GetName()[1:]
+        elif name in counters:
+            collection = name[1:]
+        else:
+            collection = "event"
+        leaves.append((leaf.GetTypeName(), name, capacity, collection))
+    # a collection together, in the order of the tree (NanoAOD appends some
+    # branches, like LowPtElectron_genPartIdx, after the other collections)
+    order = []
+    for leaf in leaves:
+        if leaf[3] not in order:
+            order.append(leaf[3])
+    leaves.sort(key=lambda leaf: order.index(leaf[3]))
+    for name in selected:
+        if name not in names:
+            print("ERROR: makeReader: {0} is not a branch of the sample; NanoReader needs it.".format(name))
+    return leaves
+
+def writeSchema(output, leaves, sample, patterns):
+    width_type = max(len(l[0]) for l in leaves) + 1
+    width_name = max(len(l[1]) for l in leaves) + 1
+    with open(output, "w") as f:
+        f.write("// Leaves of the NanoAOD Events tree read by the analysis classes.\n")
+        f.write("//\n")
+        f.write("// Each line is NANO_LEAF(type, name, capacity); the includer defines\n")
+        f.write("// NANO_LEAF before including this file (no include guard), see NanoReader.h.\n")
+        f.write("// capacity is the initial size of the buffer, grown per file to the largest\n")
+        f.write("// count of the leaf (see LazyLeaf.h).\n")
+        f.write("//\n")
+        f.write("// Generated by python/makeReader.py from {0}\n".format(os.path.basename(sample)))
+        f.write("// for: {0}\n".format(" ".join(patterns)))
+        collection = None
+        for type_name, name, capacity, group in leaves:
+            if group != collection:
+                collection = group
+                f.write("\n// {0}\n".format(collection))
+            f.write("NANO_LEAF({0:<{1}} {2:<{3}} {4})\n".format(type_name + ",", width_type, name + ",", width_name, capacity))
+    print("Wrote {0}: {1} leaves.".format(output, len(leaves)))
+
+# header and loop skeleton of a class reading through NanoReader
+def writeClass(class_name, src_dir, sample):
+    header = os.path.join(src_dir, class_name + ".h")
+    source = os.path.join(src_dir, class_name + ".C")
+    sample_name = os.path.basename(sample)
+    with open(header, "w") as f:
+        f.write("// Reads the NanoAOD Events tree through NanoReader; the default input is\n")
+        f.write("// {0}.\n\n".format(sample_name))
+        f.write("#ifndef {0}_h\n#define {0}_h\n\n".format(class_name))
+        f.write("#include \"NanoReader.h\"\n\n")
+        f.write("class {0} : public NanoReader {{\npublic :\n".format(class_name))
+        f.write("   {0}(TTree *tree=0);\n".format(class_name))
+        f.write("   virtual ~{0}();\n".format(class_name))
+        f.write("   virtual void     Loop();\n")
+        f.write("};\n\n#endif\n\n")
+        f.write("#ifdef {0}_cxx\n".format(class_name))
+        f.write("{0}::{0}(TTree *tree)\n{{\n".format(class_name))
+        f.write("// if parameter tree is not specified (or zero), connect the file\n")
+        f.write("// used to generate this class and read the Tree.\n")
+        f.write("   if (tree == 0) {\n")
+        f.write("      TFile *f = (TFile*)gROOT->GetListOfFiles()->FindObject(\"{0}\");\n".format(sample_name))
+        f.write("      if (!f || !f->IsOpen()) {\n")
+        f.write("         f = new TFile(\"{0}\");\n".format(sample_name))
+        f.write("      }\n")
+        f.write("      f->GetObject(\"Events\",tree);\n\n")
+        f.write("   }\n")
+        f.write("   Init(tree);\n}\n\n")
+        f.write("{0}::~{0}()\n{{\n}}\n".format(class_name))
+        f.write("#endif // #ifdef {0}_cxx\n".format(class_name))
+    print("Wrote {0}.".format(header))
+
+    if os.path.exists(source):
+        print("WARNING: makeReader: {0} exists, not overwritten.".format(source))
+        return
+    with open(source, "w") as f:
+        f.write("#define {0}_cxx\n".format(class_name))
+        f.write("#include \"{0}.h\"\n".format(class_name))
+        f.write("#include <TH2.h>\n#include <TStyle.h>\n#include <TCanvas.h>\n\n")
+        f.write("void {0}::Loop()\n{{\n".format(class_name))
+        f.write("    //   In a ROOT session, you can do:\n")
+        f.write("    //      root> .L {0}.C\n".format(class_name))
+        f.write("    //      root> {0} t\n".format(class_name))
+        f.write("    //      root> t.Loop();       // Loop on all entries\n")
+        f.write("    if (fChain == 0) return;\n\n")
+        f.write("    Long64_t nentries = NumEntries();\n\n")
+        f.write("    for (Long64_t jentry=0; jentry<nentries;jentry++) {\n")
+        f.write("        // branches are read on first access (see LazyLeaf.h)\n")
+        f.write("        Long64_t ientry = LoadEntry(jentry);\n")
+        f.write("        if (ientry < 0) break;\n")
+        f.write("        if (Cut(ientry) < 0) continue;\n")
+        f.write("    }\n}\n")
+    print("Wrote {0}.".format(source))
+
+def main():
+    parser = argparse.ArgumentParser(description="Write the NanoReader schema for a subset of the branches of a sample.")
+    parser.add_argument("sample", help="NanoAOD file to take the branch types and sizes from")
+    parser.add_argument("patterns", nargs="*", help="branch name patterns, e.g. 'LowPtElectron_*'")
+    parser.add_argument("-o", "--output", default="src/NanoSchema.h", help="schema file to write")
+    parser.add_argument("-t", "--tree", default="Events", help="tree name")
+    parser.add_argument("--class", dest="class_name", help="also write <src>/<class>.h and a Loop skeleton in <class>.C")
+    args = parser.parse_args()
+    patterns = args.patterns if args.patterns else default_patterns
+
+    open_file = ROOT.TFile.Open(args.sample)
+    if not open_file or open_file.IsZombie():
+        print("ERROR: makeReader: cannot open {0}.".format(args.sample))
+        return 1
+    tree = open_file.Get(args.tree)
+    if not tree:
+        print("ERROR: makeReader: no tree {0} in {1}.".format(args.tree, args.sample))
+        return 1
+
+    leaves = getLeaves(tree, patterns)
+    writeSchema(args.output, leaves, args.sample, patterns)
+    if args.class_name:
+        writeClass(args.class_name, os.path.dirname(args.output) or ".", args.sample)
+    open_file.Close()
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,234 @@
+#ifndef BootstrapRoc_h
+#define BootstrapRoc_h
+
+#include "FixedHist.h"
+#include "RocCurve.h"
+#include <Rtypes.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+// Bootstrap uncertainties of ROC curves, filled in the same pass as the
+// histograms themselves.
+//
+// Every event gets n Poisson(1) weights, one per replica (PoissonReplicas).
+// A replica is then a resampling of the events with replacement: the
+// electrons of an event share its weight, so correlations inside the event
+// are kept. The weights are a function of (run, event, seed) only, from a
+// counter-based generator, so they do not depend on the order of the files,
+// on FanOut workers or on which selections the event passes; two ROCs of the
+// same events see the same replicas, and their replica AUCs can be compared
+// pairwise.
+//
+// ReplicaHist holds the n replica histograms of one score histogram, bin
+// major, so a fill finds the bin once and adds the n weights to consecutive
+// cells. BootstrapRoc() makes the ROC of every replica and returns the
+// central interval of the signal efficiency at each point of the nominal
+// curve, and of the AUC:
+//
+//    PoissonReplicas weights(100);
+//    ReplicaHist sig(100, 22, 4.0, 12.0), bkg(100, 22, 4.0, 12.0);
+//    weights.SetEvent(run, event);                       // per event
+//    (signal ? sig : bkg).Fill(LowPtElectron_embeddedID[k], weights);
+//    RocBand band = BootstrapRoc(CumulativeRoc(sigHist, bkgHist), sig, bkg);
+//
+// A FanOut worker stores the replicas as a TH2D (ToTH2D()), which the parent
+// merges with the other histograms and turns back with FromTH2(): the sums
+// of the weights add up across workers like the nominal contents.
+
+// Poisson(1) weights of the replicas of one event.
+class PoissonReplicas {
+public :
+    PoissonReplicas(int n, ULong64_t seed = 0) : fWeights(n), fSeed(seed) {}
+
+    int Size() const { return (int) fWeights.size(); }
+    const uint8_t *Weights() const { return fWeights.data(); }
+
+    // replica r draws the r-th number of the stream keyed by (run, event, seed)
+    void SetEvent(UInt_t run, ULong64_t event)
+    {
+        // P(k <= i) of Poisson(1), i = 0 .. kMax - 1; k = kMax beyond (p ~ 1e-14)
+        static const int kMax = 16;
+        static const double kCdf[kMax] = {
+            0.36787944117144233, 0.73575888234288467, 0.91969860292860584, 0.98101184312384626,
+            0.99634015317265634, 0.99940581518241833, 0.99991675885071196, 0.99998975080332531,
+            0.99999887479740202, 0.99999988857452160, 0.99999998995223360, 0.99999999916838922,
+            0.99999999993640221, 0.99999999999548017, 0.99999999999970002, 0.99999999999998135};
+        ULong64_t key = Mix(Mix(event ^ fSeed) ^ ((ULong64_t) run << 32));
+        for (size_t r = 0; r < fWeights.size(); ++r)
+        {
+            double u = (Mix(key + r) >> 11) * 0x1.0p-53;
+            int k = 0;
+            while (k < kMax && u >= kCdf[k])
+            {
+                ++k;
+            }
+            fWeights[r] = k;
+        }
+    }
+
+private :
+    // SplitMix64 finalizer: consecutive counters give independent numbers
+    static ULong64_t Mix(ULong64_t x)
+    {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    std::vector<uint8_t> fWeights;
+    ULong64_t            fSeed;
+};
+
+// The replicas of a fixed-binning score histogram: content of bin b (TH1
+// numbering, under/overflow included) in replica r at b * n + r.
+class ReplicaHist {
+public :
+    ReplicaHist(int n_replicas, int nx, double xlow, double xhigh)
+        : fX(nx, xlow, xhigh), fN(n_replicas), fSumw((nx + 2) * n_replicas) {}
+
+    int    Replicas() const { return fN; }
+    int    GetNbinsX() const { return fX.fN; }
+    double GetBinContent(int bin, int r) const { return fSumw[bin * fN + r]; }
+
+    // x: the bins, under/overflow included; y: replica r in bin r + 1
+    std::unique_ptr<TH2D> ToTH2D(const char *name) const
+    {
+        std::unique_ptr<TH2D> hist(new TH2D(name, name, fX.fN, fX.fLow, fX.fHigh, fN, 0, fN));
+        hist->SetDirectory(0);
+        for (int bin = 0; bin <= fX.fN + 1; ++bin)
+        {
+            for (int r = 0; r < fN; ++r)
+            {
+                hist->SetBinContent(bin, r + 1, GetBinContent(bin, r));
+            }
+        }
+        return hist;
+    }
+
+    static ReplicaHist FromTH2(TH2 &hist)
+    {
+        ReplicaHist replicas(hist.GetNbinsY(), hist.GetNbinsX(), hist.GetXaxis()->GetXmin(), hist.GetXaxis()->GetXmax());
+        for (int bin = 0; bin <= replicas.fX.fN + 1; ++bin)
+        {
+            for (int r = 0; r < replicas.fN; ++r)
+            {
+                replicas.fSumw[bin * replicas.fN + r] = hist.GetBinContent(bin, r + 1);
+            }
+        }
+        return replicas;
+    }
+
+    void Fill(double x, const PoissonReplicas &weights)
+    {
+        double *cell = &fSumw[fX.FindBin(x) * fN];
+        const uint8_t *w = weights.Weights();
+        for (int r = 0; r < fN; ++r)
+        {
+            cell[r] += w[r];
+        }
+    }
+
+private :
+    FixedAxis           fX;
+    int                 fN;
+    std::vector<double> fSumw;
+};
+
+// Central interval holding cl of values, NaN left out; (NaN, NaN) if none is left.
+inline std::pair<double, double> CentralInterval(std::vector<double> values, double cl = 0.6827)
+{
+    values.erase(std::remove_if(values.begin(), values.end(), [](double v) { return std::isnan(v); }), values.end());
+    if (values.empty())
+    {
+        return {NAN, NAN};
+    }
+    std::sort(values.begin(), values.end());
+    // linear between order statistics
+    auto quantile = [&](double q) {
+        double pos = q * (values.size() - 1);
+        size_t i = (size_t) pos;
+        return i + 1 < values.size() ? values[i] + (pos - i) * (values[i + 1] - values[i]) : values[i];
+    };
+    return {quantile((1 - cl) / 2), quantile((1 + cl) / 2)};
+}
+
+// Bootstrap band of a ROC curve, at the points of the nominal curve.
+struct RocBand
+{
+    std::vector<double> fpr;          // nominal curve
+    std::vector<double> tpr;
+    std::vector<double> tpr_low;      // central interval of the replicas at fpr
+    std::vector<double> tpr_high;
+    double              auc = 0;      // nominal
+    double              auc_low = 0;
+    double              auc_high = 0;
+    std::vector<double> replica_auc;  // per replica, NaN if the replica is empty
+
+    bool Empty() const { return fpr.empty(); }
+};
+
+// The band of nominal from the replicas in sig and bkg, at confidence level cl.
+inline RocBand BootstrapRoc(const RocCurve &nominal, const ReplicaHist &sig, const ReplicaHist &bkg, double cl = 0.6827)
+{
+    RocBand band;
+    int nbins = sig.GetNbinsX();
+    if (nominal.Empty() || bkg.GetNbinsX() != nbins || (int) nominal.fpr.size() != nbins || bkg.Replicas() != sig.Replicas())
+    {
+        printf("ERROR: BootstrapRoc: replicas and nominal curve do not match.\n");
+        return band;
+    }
+    band.fpr = nominal.fpr;
+    band.tpr = nominal.tpr;
+    band.auc = nominal.AUC();
+
+    // efficiency of every replica at every nominal point, point major
+    int n = sig.Replicas();
+    std::vector<double> at(nbins * n, NAN);
+    band.replica_auc.assign(n, NAN);
+    int n_empty = 0;
+    for (int r = 0; r < n; ++r)
+    {
+        // a replica may draw no signal or no background in a sparse category:
+        // expected, left out and counted rather than reported one by one
+        double sig_sum = 0;
+        double bkg_sum = 0;
+        for (int bin = 1; bin <= nbins; ++bin)
+        {
+            sig_sum += sig.GetBinContent(bin, r);
+            bkg_sum += bkg.GetBinContent(bin, r);
+        }
+        if (sig_sum == 0 || bkg_sum == 0)
+        {
+            ++n_empty;
+            continue;
+        }
+        RocCurve roc = CumulativeRoc(nbins, [&](int bin) { return sig.GetBinContent(bin, r); },
+                                     [&](int bin) { return bkg.GetBinContent(bin, r); });
+        band.replica_auc[r] = roc.AUC();
+        for (int i = 0; i < nbins; ++i)
+        {
+            at[i * n + r] = roc.SignalEfficiencyAt(nominal.fpr[i]);
+        }
+    }
+    if (n_empty > 0)
+    {
+        printf("WARNING: BootstrapRoc: %d of %d replicas without signal or background left out.\n", n_empty, n);
+    }
+    std::tie(band.auc_low, band.auc_high) = CentralInterval(band.replica_auc, cl);
+    band.tpr_low.resize(nbins);
+    band.tpr_high.resize(nbins);
+    for (int i = 0; i < nbins; ++i)
+    {
+        std::vector<double> point(at.begin() + i * n, at.begin() + (i + 1) * n);
+        std::tie(band.tpr_low[i], band.tpr_high[i]) = CentralInterval(point, cl);
+    }
+    return band;
+}
+
+#endif
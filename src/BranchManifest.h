@@ -0,0 +1,307 @@
+#ifndef BranchManifest_h
+#define BranchManifest_h
+
+#include <TTree.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TObjArray.h>
+#include <TFile.h>
+#include <TEnv.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <cstdio>
+
+// List of branches read by one analysis method.
+//
+// Fill it next to the histogram booking, then call Apply(fChain) before the
+// event loop. Apply() disables every branch ("*",0) and re-enables only the
+// declared ones, so fChain->GetEntry() only decompresses what the method uses.
+// The previous state (all branches on) is restored when the manifest goes out
+// of scope, so the next method starts from a clean chain.
+//
+//    BranchManifest manifest;
+//    manifest.Add({"nLowPtElectron", "LowPtElectron_pt", "LowPtElectron_eta"});
+//    if (!manifest.Apply(fChain)) return;
+//
+// Names may use the same wildcards as TTree::SetBranchStatus.
+//
+// Apply() also sets up a TTreeCache for the declared branches, so each
+// cluster of baskets is fetched in a few large reads instead of one read per
+// basket, and Release() reports the read calls and bytes of the loop. The
+// cache is configured for all loops through Cache():
+//
+//    BranchManifest::Cache().cache_bytes   = 50000000;  // default -1: sized from the branches
+//    BranchManifest::Cache().learn_entries = 100;       // default 0: register the declared branches
+//    BranchManifest::Cache().prefetch      = false;     // default true: asynchronous prefetching
+//
+// Prefetching is a gEnv setting (TFile.AsyncPrefetching). It is turned on by
+// the first applied manifest and the previous value is restored when the last
+// one is released. gEnv is not thread safe, so a method running its loops in
+// threads holds a Prefetch on the main thread around them; the manifests of
+// the threads then find it set and never write it:
+//
+//    BranchManifest::Prefetch prefetch;
+//    for (...) threads.push_back(std::thread(...));   // each Apply()s its manifest
+class BranchManifest {
+public :
+    struct CacheConfig {
+        Long64_t cache_bytes;    // < 0: sized from the enabled branches, 0: no cache
+        Int_t    learn_entries;  // > 0: let the cache learn the branches over this many entries
+        bool     prefetch;       // prefetch the next cluster while reading (files opened afterwards)
+        bool     report;         // print read calls and bytes in Release()
+    };
+    static CacheConfig &Cache()
+    {
+        static CacheConfig config = {-1, 0, true, true};
+        return config;
+    }
+
+    // TFile.AsyncPrefetching as configured, for the lifetime of the object
+    class Prefetch {
+    public :
+        Prefetch() { StartPrefetch(); }
+        ~Prefetch() { StopPrefetch(); }
+        Prefetch(const Prefetch &) = delete;
+        Prefetch &operator=(const Prefetch &) = delete;
+    };
+
+    BranchManifest() : fTree(0), fPrefetch(false), fCacheBytes(0), fReadCalls(-1), fBytesRead(0) {}
+    ~BranchManifest() { Release(); }
+
+    void Add(std::string name);
+    void Add(std::vector<std::string> names);
+    bool Has(std::string name) const;
+    const std::vector<std::string> &Names() const { return fNames; }
+
+    bool Apply(TTree *tree);
+    void Release();
+
+private :
+    void ApplyCache();
+    Long64_t CacheSize() const;
+    static void StartPrefetch();
+    static void StopPrefetch();
+    // users of the prefetch setting, and the value it had before the first
+    struct PrefetchUsers {
+        std::mutex mutex;
+        int        users = 0;
+        bool       set = false;
+        int        previous = 0;
+    };
+    static PrefetchUsers &PrefetchState()
+    {
+        static PrefetchUsers state;
+        return state;
+    }
+
+    std::vector<std::string> fNames;
+    TTree *fTree;
+    bool fPrefetch;  // counted in StartPrefetch()
+    Long64_t fCacheBytes;
+    Int_t fReadCalls;  // TFile::GetFileReadCalls() at Apply(), -1 before
+    Long64_t fBytesRead;
+};
+
+inline void BranchManifest::Add(std::string name)
+{
+    if (!Has(name))
+    {
+        fNames.push_back(name);
+    }
+}
+
+inline void BranchManifest::Add(std::vector<std::string> names)
+{
+    for (const auto &name : names)
+    {
+        Add(name);
+    }
+}
+
+inline bool BranchManifest::Has(std::string name) const
+{
+    for (const auto &n : fNames)
+    {
+        if (n == name)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Disable all branches and enable only the declared ones.
+// Returns false (and leaves every branch enabled) if a declared name does not
+// match any branch, so a typo fails before the loop instead of silently
+// reading zeros.
+inline bool BranchManifest::Apply(TTree *tree)
+{
+    if (!tree)
+    {
+        return false;
+    }
+    // before the first file is opened
+    if (!fPrefetch)
+    {
+        StartPrefetch();
+        fPrefetch = true;
+    }
+    // a TChain only reports matches once a tree is loaded
+    if (tree->GetTree() == 0 && tree->LoadTree(0) < 0)
+    {
+        printf("ERROR: BranchManifest: no tree to apply branch status to.\n");
+        StopPrefetch();
+        fPrefetch = false;
+        return false;
+    }
+    fTree = tree;
+    fTree->SetBranchStatus("*", 0);
+
+    bool ok = true;
+    for (const auto &name : fNames)
+    {
+        UInt_t found = 0;
+        fTree->SetBranchStatus(name.c_str(), 1, &found);
+        if (found == 0)
+        {
+            printf("ERROR: BranchManifest: branch '%s' does not exist in tree '%s'.\n", name.c_str(), fTree->GetName());
+            ok = false;
+        }
+    }
+    if (!ok)
+    {
+        Release();
+        return false;
+    }
+
+    // variable size arrays are unreadable without their counter branch
+    // (e.g. LowPtElectron_pt needs nLowPtElectron); enable it if it was missed
+    TObjArray *branches = fTree->GetTree()->GetListOfBranches();
+    int n_active = 0;
+    for (int i = 0; i < branches->GetEntriesFast(); ++i)
+    {
+        TBranch *branch = (TBranch*)branches->UncheckedAt(i);
+        if (!fTree->GetBranchStatus(branch->GetName()))
+        {
+            continue;
+        }
+        ++n_active;
+        TLeaf *leaf = (TLeaf*)branch->GetListOfLeaves()->UncheckedAt(0);
+        TLeaf *count = leaf ? leaf->GetLeafCount() : 0;
+        if (count && !fTree->GetBranchStatus(count->GetBranch()->GetName()))
+        {
+            printf("WARNING: BranchManifest: enabling counter '%s' needed by '%s'.\n", count->GetBranch()->GetName(), branch->GetName());
+            fTree->SetBranchStatus(count->GetBranch()->GetName(), 1);
+            Add(count->GetBranch()->GetName());
+            ++n_active;
+        }
+    }
+    printf("BranchManifest: reading %d of %d branches.\n", n_active, branches->GetEntriesFast());
+    ApplyCache();
+    return true;
+}
+
+// Size the read cache and register the declared branches (or start learning).
+inline void BranchManifest::ApplyCache()
+{
+    fCacheBytes = Cache().cache_bytes < 0 ? CacheSize() : Cache().cache_bytes;
+    if (fCacheBytes > 0)
+    {
+        fTree->SetCacheSize(fCacheBytes);
+        if (Cache().learn_entries > 0)
+        {
+            fTree->SetCacheLearnEntries(Cache().learn_entries);
+        }
+        else
+        {
+            for (const auto &name : fNames)
+            {
+                fTree->AddBranchToCache(name.c_str(), kTRUE);
+            }
+            fTree->StopCacheLearningPhase();
+        }
+    }
+    fReadCalls = TFile::GetFileReadCalls();
+    fBytesRead = TFile::GetFileBytesRead();
+}
+
+// Compressed size of one cluster of the enabled branches, twice (one cluster
+// is read while the next one is prefetched), between 1 MB and 256 MB.
+inline Long64_t BranchManifest::CacheSize() const
+{
+    TTree *tree = fTree->GetTree();
+    Long64_t entries = tree->GetEntries();
+    if (entries <= 0)
+    {
+        return 0;
+    }
+    Long64_t zip_bytes = 0;
+    TObjArray *branches = tree->GetListOfBranches();
+    for (int i = 0; i < branches->GetEntriesFast(); ++i)
+    {
+        TBranch *branch = (TBranch*)branches->UncheckedAt(i);
+        if (fTree->GetBranchStatus(branch->GetName()))
+        {
+            zip_bytes += branch->GetZipBytes();
+        }
+    }
+    // a negative auto flush is a size in bytes, not a number of entries
+    Long64_t cluster = tree->GetAutoFlush() > 0 ? std::min(tree->GetAutoFlush(), entries) : entries;
+    Long64_t size = 2 * (Long64_t)((double)zip_bytes * cluster / entries);
+    return std::max(1LL << 20, std::min(size, 256LL << 20));
+}
+
+// Turn prefetching on for the first user, if configured; the others only count.
+inline void BranchManifest::StartPrefetch()
+{
+    std::lock_guard<std::mutex> lock(PrefetchState().mutex);
+    if (PrefetchState().users++ == 0 && Cache().prefetch)
+    {
+        PrefetchState().previous = gEnv->GetValue("TFile.AsyncPrefetching", 0);
+        PrefetchState().set = true;
+        gEnv->SetValue("TFile.AsyncPrefetching", 1);
+    }
+}
+
+// Restore the setting found by the first user once the last one is done.
+inline void BranchManifest::StopPrefetch()
+{
+    std::lock_guard<std::mutex> lock(PrefetchState().mutex);
+    if (--PrefetchState().users == 0 && PrefetchState().set)
+    {
+        gEnv->SetValue("TFile.AsyncPrefetching", PrefetchState().previous);
+        PrefetchState().set = false;
+    }
+}
+
+// Re-enable every branch of the tree the manifest was applied to.
+inline void BranchManifest::Release()
+{
+    if (fPrefetch)
+    {
+        StopPrefetch();
+        fPrefetch = false;
+    }
+    if (!fTree)
+    {
+        return;
+    }
+    // only loops that got past Apply() are reported
+    if (Cache().report && fReadCalls >= 0)
+    {
+        printf("BranchManifest: %d read calls, %.1f MB read (cache %.1f MB).\n",
+               TFile::GetFileReadCalls() - fReadCalls, (TFile::GetFileBytesRead() - fBytesRead) / 1e6, fCacheBytes / 1e6);
+    }
+    if (fCacheBytes > 0)
+    {
+        fTree->SetCacheSize(0);
+        fCacheBytes = 0;
+    }
+    fReadCalls = -1;
+    fTree->SetBranchStatus("*", 1);
+    fTree = 0;
+}
+
+#endif
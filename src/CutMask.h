@@ -0,0 +1,241 @@
+#ifndef CutMask_h
+#define CutMask_h
+
+#include "HistRegistry.h"
+#include <TH1.h>
+#include <string>
+#include <vector>
+
+// Electron selections as bitmasks.
+//
+// NanoReader::ElectronCuts() evaluates each atomic cut of an electron once
+// and sets one bit per passing cut. A selection category is a mask/value
+// pair: the electron is in the category when the bits under mask equal
+// value, so a cut can be required to pass (bit in mask and value) or to fail
+// (bit in mask only):
+//
+//    IRON1   iso < 4  && |dxy| < 0.05 && |dz| < 0.1 && IPSig1 < 2
+//    IRON2   iso < 4  && |dxy| < 0.05 && |dz| < 0.1 && |dzSig| < 2
+//    LONG1   iso < 4  && IPSig1 >= 2
+//    LONG2   iso < 4  && |dzSig| >= 2
+//    FAKE    iso >= 4 && |dxy| < 0.05 && |dz| < 0.1 && IPSig1 < 2
+//
+// Each loop adds its own gate (pT window, conversion veto, eta, ID) with
+// CutCategory::With(), and dispatches the histogram fills from a table of
+// CategoryHists, or from a table of CutCategory rows into an electron
+// HistRegistry (FillCategories()). A new category is a new table row.
+enum ElectronCut : UInt_t {
+    kCutPtWindow = 1 << 0,  // lower_pt <= pt < higher_pt
+    kCutConvVeto = 1 << 1,  // convVeto == 1
+    kCutEta      = 1 << 2,  // |eta| < 2.4
+    kCutIDLoose  = 1 << 3,  // embeddedID >= id_loose
+    kCutID       = 1 << 4,  // embeddedID >= id
+    kCutIso      = 1 << 5,  // miniPFRelIso_all < 4
+    kCutDxy      = 1 << 6,  // |dxy| < 0.05
+    kCutDz       = 1 << 7,  // |dz| < 0.1
+    kCutIPSig1   = 1 << 8,  // IPSig1 < 2
+    kCutDzSig    = 1 << 9   // |dzSig| < 2
+};
+
+// thresholds of the cuts that differ between the loops
+struct ElectronCutThresholds {
+    float lower_pt;
+    float higher_pt;
+    float id_loose;
+    float id;
+};
+
+struct CutCategory {
+    std::string name;
+    UInt_t      mask;
+    UInt_t      value;
+
+    bool Pass(UInt_t bits) const { return (bits & mask) == value; }
+    // the same category, inside the gate (cuts that must all pass)
+    CutCategory With(UInt_t gate) const { return {name, mask | gate, value | gate}; }
+};
+
+namespace ElectronCategories {
+    const UInt_t kPrompt = kCutDxy | kCutDz | kCutIPSig1;
+    const CutCategory kIron1 = {"IRON1", kCutIso | kPrompt, kCutIso | kPrompt};
+    const CutCategory kIron2 = {"IRON2", kCutIso | kCutDxy | kCutDz | kCutDzSig, kCutIso | kCutDxy | kCutDz | kCutDzSig};
+    const CutCategory kLong1 = {"LONG1", kCutIso | kCutIPSig1, kCutIso};
+    const CutCategory kLong2 = {"LONG2", kCutIso | kCutDzSig, kCutIso};
+    const CutCategory kFake  = {"FAKE",  kCutIso | kPrompt, kPrompt};
+}
+
+// values of one electron filled into the histograms
+struct ElectronValues {
+    float embeddedID;
+    float eta;
+    float pt;
+    float dxy;
+    float dz;
+    float dzErr;
+    float dxyErr;
+    float dzSig;
+    float dxySig;
+    float IPSig1;
+    float convVeto;
+    float iso;
+    float IPdiff;
+    float IPSig2;
+    float IP;
+    float IPErr;
+    int   flavour;  // genPartFlav
+};
+
+// ElectronValues in order: the variable axis of an electron HistRegistry.
+enum ElectronVariable {
+    kVarEMID, kVarEta, kVarPt, kVarDxy, kVarDz, kVarDzErr, kVarDxyErr, kVarDzSig,
+    kVarDxySig, kVarIPSig1, kVarCONV, kVarISO, kVarIPSigdiff, kVarIPSig2, kVarIP, kVarIPErr,
+    kNElectronVariables
+};
+
+// histogram names of the variables
+const char *const kElectronVariableNames[kNElectronVariables] = {
+    "EMID", "eta", "pt", "dxy", "dz", "dzErr", "dxyErr", "dzSig",
+    "dxySig", "IPSig1", "CONV", "ISO", "IPSigDiff", "IPSig2", "IP", "IPErr"
+};
+
+// generator flavours of an electron HistRegistry: all, then FlavourSlot() + 1
+const int kNElectronFlavours = 4;
+const char *const kElectronFlavourNames[kNElectronFlavours] = {"", "FLAV0", "FLAV1", "FLAV5"};
+
+// One histogram per electron value; a null pointer is not filled.
+struct ElectronHists {
+    TH1F *EMID = 0, *eta = 0, *pt = 0, *dxy = 0, *dz = 0, *dzErr = 0, *dxyErr = 0, *dzSig = 0,
+         *dxySig = 0, *IPSig1 = 0, *CONV = 0, *ISO = 0, *IPSigdiff = 0, *IPSig2 = 0, *IP = 0, *IPErr = 0;
+
+    void Fill(const ElectronValues &v) const
+    {
+        if (EMID)      EMID->Fill(v.embeddedID);
+        if (eta)       eta->Fill(v.eta);
+        if (pt)        pt->Fill(v.pt);
+        if (dxy)       dxy->Fill(v.dxy);
+        if (dz)        dz->Fill(v.dz);
+        if (dzErr)     dzErr->Fill(v.dzErr);
+        if (dxyErr)    dxyErr->Fill(v.dxyErr);
+        if (dzSig)     dzSig->Fill(v.dzSig);
+        if (dxySig)    dxySig->Fill(v.dxySig);
+        if (IPSig1)    IPSig1->Fill(v.IPSig1);
+        if (CONV)      CONV->Fill(v.convVeto);
+        if (ISO)       ISO->Fill(v.iso);
+        if (IPSigdiff) IPSigdiff->Fill(v.IPdiff);
+        if (IPSig2)    IPSig2->Fill(v.IPSig2);
+        if (IP)        IP->Fill(v.IP);
+        if (IPErr)     IPErr->Fill(v.IPErr);
+    }
+};
+
+// an ElectronHists filling only the embedded ID
+inline ElectronHists EMIDHists(TH1F *emid)
+{
+    ElectronHists hists;
+    hists.EMID = emid;
+    return hists;
+}
+
+// The ElectronHists of the members prefix##EMID, prefix##eta, ... of an
+// analysis histogram struct, e.g. ELECTRON_HISTS(IRON1_FLAV0_).
+#define ELECTRON_HISTS(prefix) \
+    ElectronHists{&prefix##EMID, &prefix##eta, &prefix##pt, &prefix##dxy, &prefix##dz, &prefix##dzErr, &prefix##dxyErr, &prefix##dzSig, \
+                  &prefix##dxySig, &prefix##IPSig1, &prefix##CONV, &prefix##ISO, &prefix##IPSigdiff, &prefix##IPSig2, &prefix##IP, &prefix##IPErr}
+
+// Histograms of a category: all its electrons, and per generator flavour
+// (genPartFlav 0, 1 and 5, see FlavourSlot()).
+struct CategoryHists {
+    CutCategory   cut;
+    ElectronHists all;
+    ElectronHists flavour[3];
+};
+
+// index of genPartFlav in CategoryHists::flavour: unmatched, prompt, b; -1 otherwise
+inline int FlavourSlot(int flavour)
+{
+    return flavour == 0 ? 0 : flavour == 1 ? 1 : flavour == 5 ? 2 : -1;
+}
+
+// cuts every category of table requires to pass
+inline UInt_t RequiredCuts(const std::vector<CutCategory> &table)
+{
+    UInt_t required = ~0u;
+    for (const auto &c : table)
+    {
+        required &= c.mask & c.value;
+    }
+    return table.empty() ? 0 : required;
+}
+
+inline UInt_t RequiredCuts(const std::vector<CategoryHists> &table)
+{
+    std::vector<CutCategory> cuts;
+    for (const auto &c : table)
+    {
+        cuts.push_back(c.cut);
+    }
+    return RequiredCuts(cuts);
+}
+
+// Fill the kNElectronVariables histograms of the registry row starting at
+// index row, e.g. hists.Index(category, flavour, kVarEMID, slice).
+inline void FillElectron(HistRegistry<FixedHist1> &hists, int row, const ElectronValues &v)
+{
+    FixedHist1 *h = &hists.At(row);
+    h[kVarEMID].Fill(v.embeddedID);
+    h[kVarEta].Fill(v.eta);
+    h[kVarPt].Fill(v.pt);
+    h[kVarDxy].Fill(v.dxy);
+    h[kVarDz].Fill(v.dz);
+    h[kVarDzErr].Fill(v.dzErr);
+    h[kVarDxyErr].Fill(v.dxyErr);
+    h[kVarDzSig].Fill(v.dzSig);
+    h[kVarDxySig].Fill(v.dxySig);
+    h[kVarIPSig1].Fill(v.IPSig1);
+    h[kVarCONV].Fill(v.convVeto);
+    h[kVarISO].Fill(v.iso);
+    h[kVarIPSigdiff].Fill(v.IPdiff);
+    h[kVarIPSig2].Fill(v.IPSig2);
+    h[kVarIP].Fill(v.IP);
+    h[kVarIPErr].Fill(v.IPErr);
+}
+
+// fill the histograms of every category of table the electron is in
+inline void FillCategories(const std::vector<CategoryHists> &table, UInt_t bits, const ElectronValues &v)
+{
+    int slot = FlavourSlot(v.flavour);
+    for (const auto &c : table)
+    {
+        if (!c.cut.Pass(bits))
+        {
+            continue;
+        }
+        c.all.Fill(v);
+        if (slot >= 0)
+        {
+            c.flavour[slot].Fill(v);
+        }
+    }
+}
+
+// The same for a table of categories booked as the categories of an electron
+// HistRegistry (kNElectronFlavours x kNElectronVariables): row c of table
+// fills category c of hists, in pT slice s.
+inline void FillCategories(const std::vector<CutCategory> &table, HistRegistry<FixedHist1> &hists, UInt_t bits, const ElectronValues &v, int s = 0)
+{
+    int slot = FlavourSlot(v.flavour);
+    for (int c = 0; c < (int) table.size(); ++c)
+    {
+        if (!table[c].Pass(bits))
+        {
+            continue;
+        }
+        FillElectron(hists, hists.Index(c, 0, 0, s), v);
+        if (slot >= 0)
+        {
+            FillElectron(hists, hists.Index(c, slot + 1, 0, s), v);
+        }
+    }
+}
+
+#endif
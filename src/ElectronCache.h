@@ -0,0 +1,422 @@
+#ifndef ElectronCache_h
+#define ElectronCache_h
+
+#include <TTree.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TObjArray.h>
+#include "LazyLeaf.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdio>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Columnar cache of one NanoAOD collection (LowPtElectron by default).
+//
+// Build() reads the collection once and writes a flat structure-of-arrays
+// file: one contiguous array per leaf of the collection, a few event scalars
+// (run, luminosityBlock, event), the counter and an "offsets" array with the
+// index of the first element of each event (n_entries + 1 values). Open()
+// memory-maps the file; the analysis classes map their LazyLeaf members onto
+// the columns (UseCache()) and run their loops from the mapping:
+//
+//    TChain *chain = new TChain("Events");
+//    chain->Add("/store/.../*.root");
+//    ElectronCache::Build(chain, "ttjets_lpe.cache");   // once
+//    TTJETS t;
+//    t.UseCache("ttjets_lpe.cache");
+//    t.Loop2();                                          // no ROOT I/O
+//
+// Layout (native byte order, written and read on the same architecture):
+// Header, n_columns x Column, then the column data, each column aligned
+// to kAlign bytes.
+class ElectronCache {
+public :
+    struct Header {
+        char     magic[8];
+        UInt_t   version;
+        UInt_t   n_columns;
+        Long64_t n_entries;
+        Long64_t n_elements;
+    };
+    struct Column {
+        char     name[64];
+        char     type[16];
+        Long64_t offset;       // from the start of the file
+        Long64_t n_values;
+        Int_t    value_size;
+        Int_t    per_element;  // 1: one value per element, 0: one per event
+    };
+    static const UInt_t   kVersion = 1;
+    static const Long64_t kAlign   = 64;
+
+    ElectronCache() : fData(0), fSize(0), fEntries(0), fElements(0), fOffsets(0) {}
+    ~ElectronCache() { Close(); }
+
+    static bool Build(TTree *tree, std::string path, std::string collection = "LowPtElectron",
+                      std::vector<std::string> scalars = {"run", "luminosityBlock", "event"});
+
+    bool Open(std::string path);
+    void Close();
+
+    const std::string &Path() const { return fPath; }
+    Long64_t Entries() const { return fEntries; }
+    Long64_t Elements() const { return fElements; }
+    bool Has(std::string name) const { return fColumns.count(name) > 0; }
+    bool Provides(const std::vector<std::string> &names) const;
+
+    // Select event entry for the LazyLeaf members sharing lazy; returns -1
+    // past the last event (like LoadTree()).
+    Long64_t Select(Long64_t entry, LazyEntry &lazy) const
+    {
+        if (entry < 0 || entry >= fEntries)
+        {
+            return -1;
+        }
+        lazy.SetCached(entry, fOffsets[entry]);
+        return entry;
+    }
+
+    template <typename T, int N>
+    bool Attach(std::string name, LazyLeaf<T, N> &leaf) const;
+
+private :
+    template <typename T> static const char *TypeName();
+
+    std::string                    fPath;
+    char                          *fData;
+    Long64_t                       fSize;
+    Long64_t                       fEntries;
+    Long64_t                       fElements;
+    const Long64_t                *fOffsets;
+    std::map<std::string, Column>  fColumns;
+};
+
+template <> inline const char *ElectronCache::TypeName<Float_t>()   { return "Float_t"; }
+template <> inline const char *ElectronCache::TypeName<Double_t>()  { return "Double_t"; }
+template <> inline const char *ElectronCache::TypeName<Int_t>()     { return "Int_t"; }
+template <> inline const char *ElectronCache::TypeName<UInt_t>()    { return "UInt_t"; }
+template <> inline const char *ElectronCache::TypeName<Short_t>()   { return "Short_t"; }
+template <> inline const char *ElectronCache::TypeName<UShort_t>()  { return "UShort_t"; }
+template <> inline const char *ElectronCache::TypeName<Char_t>()    { return "Char_t"; }
+template <> inline const char *ElectronCache::TypeName<UChar_t>()   { return "UChar_t"; }
+template <> inline const char *ElectronCache::TypeName<Bool_t>()    { return "Bool_t"; }
+template <> inline const char *ElectronCache::TypeName<Long64_t>()  { return "Long64_t"; }
+template <> inline const char *ElectronCache::TypeName<ULong64_t>() { return "ULong64_t"; }
+
+// Write the cache of collection from tree to path.
+// The tree's branch status is changed, so pass a chain that is not used by an
+// analysis object at the same time. The file is written next to path and
+// renamed at the end, an interrupted build never leaves a truncated cache.
+inline bool ElectronCache::Build(TTree *tree, std::string path, std::string collection, std::vector<std::string> scalars)
+{
+    if (!tree || tree->LoadTree(0) < 0)
+    {
+        printf("ERROR: ElectronCache: no tree to build the cache from.\n");
+        return false;
+    }
+    std::string counter = "n" + collection;
+    std::string prefix  = collection + "_";
+
+    // columns: counter and scalars per event, then the leaves counted by the counter
+    std::vector<std::string> names = {counter};
+    std::vector<int> per_element(1, 0);
+    for (const auto &name : scalars)
+    {
+        names.push_back(name);
+        per_element.push_back(0);
+    }
+    TObjArray *branches = tree->GetTree()->GetListOfBranches();
+    for (int i = 0; i < branches->GetEntriesFast(); ++i)
+    {
+        TBranch *branch = (TBranch*)branches->UncheckedAt(i);
+        TLeaf *leaf = (TLeaf*)branch->GetListOfLeaves()->UncheckedAt(0);
+        std::string name = branch->GetName();
+        if (name.compare(0, prefix.size(), prefix) == 0 && leaf && leaf->GetLeafCount()
+            && counter == leaf->GetLeafCount()->GetName())
+        {
+            names.push_back(name);
+            per_element.push_back(1);
+        }
+    }
+
+    tree->SetBranchStatus("*", 0);
+    for (const auto &name : names)
+    {
+        UInt_t found = 0;
+        tree->SetBranchStatus(name.c_str(), 1, &found);
+        if (found == 0)
+        {
+            printf("ERROR: ElectronCache: branch '%s' does not exist in tree '%s'.\n", name.c_str(), tree->GetName());
+            tree->SetBranchStatus("*", 1);
+            return false;
+        }
+    }
+
+    // each column is streamed to its own scratch file, then concatenated
+    std::string tmp_path = path + ".tmp";
+    std::vector<FILE*> scratch;
+    for (size_t c = 0; c <= names.size(); ++c)
+    {
+        scratch.push_back(tmpfile());
+        if (!scratch.back())
+        {
+            printf("ERROR: ElectronCache: cannot create scratch files.\n");
+            for (auto f : scratch)
+            {
+                if (f) fclose(f);
+            }
+            tree->SetBranchStatus("*", 1);
+            return false;
+        }
+    }
+    FILE *offsets = scratch.back();
+    std::vector<Column> columns(names.size());
+    std::vector<TLeaf*> leaves(names.size(), 0);
+
+    Long64_t n_entries = 0;
+    Long64_t n_elements = 0;
+    Int_t tree_number = -1;
+    bool ok = true;
+    fwrite(&n_elements, sizeof(Long64_t), 1, offsets);
+    for (Long64_t jentry = 0; ok; ++jentry)
+    {
+        Long64_t ientry = tree->LoadTree(jentry);
+        if (ientry < 0) break;
+        if (tree->GetTreeNumber() != tree_number)
+        {
+            tree_number = tree->GetTreeNumber();
+            for (size_t c = 0; c < names.size(); ++c)
+            {
+                leaves[c] = tree->GetLeaf(names[c].c_str());
+                if (!leaves[c])
+                {
+                    printf("ERROR: ElectronCache: leaf '%s' missing in file %d.\n", names[c].c_str(), tree_number);
+                    ok = false;
+                }
+            }
+            if (!ok) break;
+        }
+        if (jentry % 100000 == 0)
+        {
+            printf("ElectronCache: event %lld\n", jentry);
+        }
+
+        leaves[0]->GetBranch()->GetEntry(ientry);
+        Long64_t n = (Long64_t)leaves[0]->GetValue(0);
+        for (size_t c = 0; c < names.size(); ++c)
+        {
+            TLeaf *leaf = leaves[c];
+            if (c > 0)
+            {
+                leaf->GetBranch()->GetEntry(ientry);
+            }
+            Int_t len = leaf->GetLen();
+            if ((per_element[c] && len != n) || (!per_element[c] && len != 1))
+            {
+                printf("ERROR: ElectronCache: leaf '%s' has %d values in event %lld.\n", names[c].c_str(), len, jentry);
+                ok = false;
+                break;
+            }
+            if (n_entries == 0)
+            {
+                Column &col = columns[c];
+                memset(&col, 0, sizeof(Column));
+                strncpy(col.name, names[c].c_str(), sizeof(col.name) - 1);
+                strncpy(col.type, leaf->GetTypeName(), sizeof(col.type) - 1);
+                col.value_size  = leaf->GetLenType();
+                col.per_element = per_element[c];
+            }
+            fwrite(leaf->GetValuePointer(), leaf->GetLenType(), len, scratch[c]);
+            columns[c].n_values += len;
+        }
+        n_elements += n;
+        fwrite(&n_elements, sizeof(Long64_t), 1, offsets);
+        ++n_entries;
+    }
+    tree->SetBranchStatus("*", 1);
+
+    FILE *out = ok ? fopen(tmp_path.c_str(), "wb") : 0;
+    if (ok && !out)
+    {
+        printf("ERROR: ElectronCache: cannot write %s.\n", tmp_path.c_str());
+        ok = false;
+    }
+    if (ok)
+    {
+        Column off;
+        memset(&off, 0, sizeof(Column));
+        strncpy(off.name, "offsets", sizeof(off.name) - 1);
+        strncpy(off.type, TypeName<Long64_t>(), sizeof(off.type) - 1);
+        off.n_values   = n_entries + 1;
+        off.value_size = sizeof(Long64_t);
+        columns.push_back(off);
+
+        Header header;
+        memset(&header, 0, sizeof(Header));
+        memcpy(header.magic, "LPECACHE", 8);
+        header.version    = kVersion;
+        header.n_columns  = columns.size();
+        header.n_entries  = n_entries;
+        header.n_elements = n_elements;
+
+        Long64_t pos = sizeof(Header) + columns.size() * sizeof(Column);
+        for (auto &col : columns)
+        {
+            pos = (pos + kAlign - 1) / kAlign * kAlign;
+            col.offset = pos;
+            pos += col.n_values * col.value_size;
+        }
+        fwrite(&header, sizeof(Header), 1, out);
+        fwrite(columns.data(), sizeof(Column), columns.size(), out);
+
+        std::vector<char> chunk(1 << 20);
+        for (size_t c = 0; c < columns.size() && ok; ++c)
+        {
+            static const char zeros[kAlign] = {0};
+            fwrite(zeros, 1, columns[c].offset - ftell(out), out);
+            rewind(scratch[c]);
+            size_t n_read;
+            while ((n_read = fread(chunk.data(), 1, chunk.size(), scratch[c])) > 0)
+            {
+                if (fwrite(chunk.data(), 1, n_read, out) != n_read)
+                {
+                    printf("ERROR: ElectronCache: write to %s failed.\n", tmp_path.c_str());
+                    ok = false;
+                    break;
+                }
+            }
+        }
+        ok = (fclose(out) == 0) && ok;
+    }
+    for (auto f : scratch)
+    {
+        fclose(f);
+    }
+    if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        printf("ERROR: ElectronCache: building %s failed.\n", path.c_str());
+        remove(tmp_path.c_str());
+        return false;
+    }
+    printf("ElectronCache: wrote %s (%lld events, %lld %s, %d columns).\n",
+           path.c_str(), n_entries, n_elements, collection.c_str(), (int)columns.size());
+    return true;
+}
+
+// Map the file at path read-only. The columns stay valid until Close().
+inline bool ElectronCache::Open(std::string path)
+{
+    Close();
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        printf("ERROR: ElectronCache: cannot open %s.\n", path.c_str());
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header))
+    {
+        printf("ERROR: ElectronCache: %s is not a cache file.\n", path.c_str());
+        close(fd);
+        return false;
+    }
+    void *data = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        printf("ERROR: ElectronCache: cannot map %s.\n", path.c_str());
+        return false;
+    }
+    fData = (char*)data;
+    fSize = st.st_size;
+    fPath = path;
+
+    const Header *header = (const Header*)fData;
+    if (memcmp(header->magic, "LPECACHE", 8) != 0 || header->version != kVersion
+        || (Long64_t)(sizeof(Header) + header->n_columns * sizeof(Column)) > fSize)
+    {
+        printf("ERROR: ElectronCache: %s has a wrong magic or version.\n", path.c_str());
+        Close();
+        return false;
+    }
+    const Column *columns = (const Column*)(fData + sizeof(Header));
+    for (UInt_t c = 0; c < header->n_columns; ++c)
+    {
+        if (columns[c].offset + columns[c].n_values * columns[c].value_size > fSize)
+        {
+            printf("ERROR: ElectronCache: %s is truncated.\n", path.c_str());
+            Close();
+            return false;
+        }
+        fColumns[columns[c].name] = columns[c];
+    }
+    if (!Has("offsets") || fColumns["offsets"].n_values != header->n_entries + 1)
+    {
+        printf("ERROR: ElectronCache: %s has no offsets.\n", path.c_str());
+        Close();
+        return false;
+    }
+    fEntries  = header->n_entries;
+    fElements = header->n_elements;
+    fOffsets  = (const Long64_t*)(fData + fColumns["offsets"].offset);
+    // the loops read the columns front to back
+    madvise(fData, fSize, MADV_SEQUENTIAL);
+    return true;
+}
+
+inline void ElectronCache::Close()
+{
+    if (fData)
+    {
+        munmap(fData, fSize);
+    }
+    fData     = 0;
+    fSize     = 0;
+    fEntries  = 0;
+    fElements = 0;
+    fOffsets  = 0;
+    fColumns.clear();
+}
+
+// True if every name is a column of the cache; the missing ones are reported.
+inline bool ElectronCache::Provides(const std::vector<std::string> &names) const
+{
+    bool ok = true;
+    for (const auto &name : names)
+    {
+        if (!Has(name))
+        {
+            printf("ERROR: ElectronCache: %s has no column '%s'.\n", fPath.c_str(), name.c_str());
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// Map leaf onto the column name. Returns false if the column does not exist
+// or holds another type.
+template <typename T, int N>
+inline bool ElectronCache::Attach(std::string name, LazyLeaf<T, N> &leaf) const
+{
+    auto it = fColumns.find(name);
+    if (it == fColumns.end())
+    {
+        return false;
+    }
+    const Column &col = it->second;
+    if (strcmp(col.type, TypeName<T>()) != 0 || col.value_size != (Int_t)sizeof(T))
+    {
+        printf("ERROR: ElectronCache: column '%s' is %s, not %s.\n", name.c_str(), col.type, TypeName<T>());
+        return false;
+    }
+    leaf.Map((const T*)(fData + col.offset), col.per_element);
+    return true;
+}
+
+#endif
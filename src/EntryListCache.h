@@ -0,0 +1,136 @@
+#ifndef EntryListCache_h
+#define EntryListCache_h
+
+#include <TTree.h>
+#include <TChain.h>
+#include <TFile.h>
+#include <TEntryList.h>
+#include <TSystem.h>
+#include <string>
+#include <functional>
+#include <cstdio>
+
+// Persistent event preselections.
+//
+// Select() returns the TEntryList of the entries of a chain that pass a
+// preselection, one sub-list per input file. The sub-lists are stored in
+// <dir>/entrylist_<selection hash>.root and reused by later runs, so a
+// selection is only evaluated on files it has not seen yet. A file is
+// identified by its base name and number of entries, which still matches a
+// local copy of a root:// file; the selection by a hash of its definition, so
+// changing the definition string starts a new set of lists.
+//
+//    EntryListCache lists("entry_lists");
+//    TEntryList *list = lists.Select(fChain, "any |LowPtElectron_eta| < 2.4 && convVeto",
+//                                    load_entry, passes);
+//    fChain->SetEntryList(list);
+class EntryListCache {
+public :
+    EntryListCache(std::string dir) : fDir(dir) {}
+
+    // load(entry) selects a chain entry (returns < 0 past the end), then pass()
+    // decides on it. The caller owns the returned list; 0 on error.
+    TEntryList *Select(TTree *chain, std::string definition,
+                       std::function<Long64_t(Long64_t)> load, std::function<bool()> pass);
+
+    static std::string Hash(std::string text);
+
+private :
+    std::string fDir;
+};
+
+// 64 bit FNV-1a of text, as 16 hex digits.
+inline std::string EntryListCache::Hash(std::string text)
+{
+    ULong64_t h = 14695981039346656037ULL;
+    for (unsigned char c : text)
+    {
+        h = (h ^ c) * 1099511628211ULL;
+    }
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", h);
+    return hex;
+}
+
+inline TEntryList *EntryListCache::Select(TTree *chain, std::string definition,
+                                          std::function<Long64_t(Long64_t)> load, std::function<bool()> pass)
+{
+    if (!chain)
+    {
+        return 0;
+    }
+    std::string path = fDir + "/entrylist_" + Hash(definition) + ".root";
+    gSystem->mkdir(fDir.c_str(), kTRUE);
+    TFile *file = TFile::Open(path.c_str(), "UPDATE");
+    if (!file || file->IsZombie())
+    {
+        printf("ERROR: EntryListCache: cannot open %s.\n", path.c_str());
+        delete file;
+        return 0;
+    }
+
+    TChain *as_chain = dynamic_cast<TChain*>(chain);
+    // the lists are created while the cache file is gDirectory: keep them out
+    // of it, or Close() deletes them
+    TEntryList *result = new TEntryList("preselection", definition.c_str());
+    result->SetDirectory(0);
+    Long64_t n_total = 0;
+    int n_reused = 0, n_computed = 0;
+    for (Long64_t first = 0; chain->LoadTree(first) >= 0; )
+    {
+        TTree *tree = chain->GetTree();
+        Long64_t n = tree->GetEntries();
+        // sub-lists are matched to the chain by the name it was given the file under
+        std::string file_name = as_chain ? as_chain->GetListOfFiles()->At(chain->GetTreeNumber())->GetTitle()
+                                         : tree->GetCurrentFile()->GetName();
+        std::string base_name = file_name.substr(file_name.find_last_of('/') + 1);
+        std::string key = "f" + Hash(base_name + ":" + std::to_string(n));
+
+        TEntryList *sub = 0;
+        file->GetObject(key.c_str(), sub);
+        if (sub)
+        {
+            sub->SetDirectory(0);
+            ++n_reused;
+        }
+        else
+        {
+            sub = new TEntryList(key.c_str(), base_name.c_str());
+            sub->SetDirectory(0);
+            Long64_t i = 0;
+            for (; i < n; ++i)
+            {
+                if (load(first + i) < 0) break;
+                if (pass())
+                {
+                    sub->Enter(i);
+                }
+            }
+            // a stopped scan (e.g. a read from a disabled branch) must not be stored
+            if (i < n)
+            {
+                printf("ERROR: EntryListCache: selection stopped at entry %lld of %s.\n", i, file_name.c_str());
+                delete sub;
+                delete result;
+                file->Close();
+                delete file;
+                return 0;
+            }
+            file->WriteTObject(sub, key.c_str());
+            ++n_computed;
+        }
+        sub->SetTree(tree->GetName(), file_name.c_str());
+        result->Add(sub);
+        delete sub;
+        n_total += n;
+        first += n;
+    }
+    file->Close();
+    delete file;
+
+    printf("EntryListCache: %lld of %lld entries pass '%s' (%d files reused, %d computed).\n",
+           result->GetN(), n_total, definition.c_str(), n_reused, n_computed);
+    return result;
+}
+
+#endif
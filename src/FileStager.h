@@ -0,0 +1,191 @@
+#ifndef FileStager_h
+#define FileStager_h
+
+#include <TFile.h>
+#include <TSystem.h>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cstdio>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+// Local disk cache for input files read over XRootD.
+//
+// Stage(url) returns a local copy of url, copying it into the cache directory
+// on first use. Copies are named after the file's identity, not its URL: the
+// base name (a GUID for NanoAOD files) and the size, "<name>-<size>.root". The
+// same file reached through another redirector hits the same copy, and a
+// file that changed size on the remote is fetched again.
+//
+// The cache is bounded to max_bytes. Before a copy, the least recently used
+// files are removed (a hit refreshes the file's modification time). Files
+// staged by this object are never evicted by it, so a chain does not lose its
+// first files while the last ones are fetched; if a file does not fit, the
+// remote URL is used instead.
+//
+//    FileStager stager("/scratch/ttjets_cache", 200e9);
+//    chain->Add(stager.Stage("root://cmseos.fnal.gov//store/.../F.root").c_str());
+//
+// For tests, Redirect() maps a URL prefix onto a local directory acting as
+// the remote: stager.Redirect("root://cmseos.fnal.gov/", "/tmp/fake_eos/").
+class FileStager {
+public :
+    FileStager(std::string cache_dir, Long64_t max_bytes) : fDir(cache_dir), fMaxBytes(max_bytes), fHits(0), fCopies(0) {}
+
+    void Redirect(std::string from, std::string to) { fFrom = from; fTo = to; }
+    std::string Stage(std::string url);
+    std::vector<std::string> Stage(std::vector<std::string> urls);
+    void Report() const;
+
+private :
+    struct Entry {
+        std::string path;
+        Long64_t    size;
+        double      used;  // modification time, refreshed on each hit
+    };
+    std::vector<Entry> List() const;
+    bool MakeRoom(Long64_t size);
+
+    std::string           fDir;
+    Long64_t              fMaxBytes;
+    std::string           fFrom;
+    std::string           fTo;
+    std::set<std::string> fPinned;
+    int                   fHits;
+    int                   fCopies;
+};
+
+inline std::string FileStager::Stage(std::string url)
+{
+    std::string source = url;
+    if (!fFrom.empty() && source.compare(0, fFrom.size(), fFrom) == 0)
+    {
+        source = fTo + source.substr(fFrom.size());
+    }
+
+    FileStat_t stat_source;
+    if (gSystem->GetPathInfo(source.c_str(), stat_source) != 0)
+    {
+        printf("WARNING: FileStager: cannot stat %s, reading it remotely.\n", source.c_str());
+        return source;
+    }
+    std::string name = source.substr(source.find_last_of('/') + 1);
+    if (name.size() > 5 && name.compare(name.size() - 5, 5, ".root") == 0)
+    {
+        name.resize(name.size() - 5);
+    }
+    std::string local = fDir + "/" + name + "-" + std::to_string(stat_source.fSize) + ".root";
+
+    struct stat stat_local;
+    if (stat(local.c_str(), &stat_local) == 0 && stat_local.st_size == stat_source.fSize)
+    {
+        utime(local.c_str(), 0);
+        fPinned.insert(local);
+        ++fHits;
+        return local;
+    }
+
+    gSystem->mkdir(fDir.c_str(), kTRUE);
+    if (!MakeRoom(stat_source.fSize))
+    {
+        printf("WARNING: FileStager: no room for %s (%lld bytes), reading it remotely.\n", name.c_str(), stat_source.fSize);
+        return source;
+    }
+    // copy next to the final name and rename, so a reader never sees a partial file
+    std::string tmp = local + ".part" + std::to_string(gSystem->GetPid());
+    printf("FileStager: copying %s\n", source.c_str());
+    if (!TFile::Cp(source.c_str(), tmp.c_str(), kFALSE)
+        || stat(tmp.c_str(), &stat_local) != 0 || stat_local.st_size != stat_source.fSize
+        || rename(tmp.c_str(), local.c_str()) != 0)
+    {
+        printf("WARNING: FileStager: copy of %s failed, reading it remotely.\n", source.c_str());
+        remove(tmp.c_str());
+        return source;
+    }
+    fPinned.insert(local);
+    ++fCopies;
+    return local;
+}
+
+inline std::vector<std::string> FileStager::Stage(std::vector<std::string> urls)
+{
+    for (auto &url : urls)
+    {
+        url = Stage(url);
+    }
+    return urls;
+}
+
+inline void FileStager::Report() const
+{
+    Long64_t total = 0;
+    std::vector<Entry> entries = List();
+    for (const auto &e : entries)
+    {
+        total += e.size;
+    }
+    printf("FileStager: %d hits, %d copies; %s holds %d files, %.2f of %.2f GB.\n",
+           fHits, fCopies, fDir.c_str(), (int)entries.size(), total / 1e9, fMaxBytes / 1e9);
+}
+
+// Staged files in the cache directory, least recently used first.
+inline std::vector<FileStager::Entry> FileStager::List() const
+{
+    std::vector<Entry> entries;
+    DIR *dir = opendir(fDir.c_str());
+    if (!dir)
+    {
+        return entries;
+    }
+    while (struct dirent *d = readdir(dir))
+    {
+        std::string name = d->d_name;
+        struct stat st;
+        std::string path = fDir + "/" + name;
+        if (name.size() > 5 && name.compare(name.size() - 5, 5, ".root") == 0
+            && stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode))
+        {
+            entries.push_back({path, (Long64_t)st.st_size, st.st_mtim.tv_sec + 1e-9 * st.st_mtim.tv_nsec});
+        }
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.used < b.used; });
+    return entries;
+}
+
+// Evict least recently used files until size more bytes fit.
+inline bool FileStager::MakeRoom(Long64_t size)
+{
+    if (size > fMaxBytes)
+    {
+        return false;
+    }
+    std::vector<Entry> entries = List();
+    Long64_t total = 0;
+    for (const auto &e : entries)
+    {
+        total += e.size;
+    }
+    for (const auto &e : entries)
+    {
+        if (total + size <= fMaxBytes)
+        {
+            break;
+        }
+        if (fPinned.count(e.path))
+        {
+            continue;
+        }
+        printf("FileStager: evicting %s\n", e.path.c_str());
+        if (remove(e.path.c_str()) == 0)
+        {
+            total -= e.size;
+        }
+    }
+    return total + size <= fMaxBytes;
+}
+
+#endif
@@ -0,0 +1,273 @@
+#ifndef FixedHist_h
+#define FixedHist_h
+
+#include <TH1.h>
+#include <TH2.h>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Fill-side histograms with uniform binning fixed by the constructor.
+//
+// The fill loops fill hundreds of histograms per electron; a TH1F::Fill goes
+// through a virtual call, the TAxis lookup and the bookkeeping of options the
+// loops never use. FixedHist1 and FixedHist2 keep what a fill changes, in
+// plain arrays:
+//
+//    bin contents and sums of squared weights, under/overflow bins included
+//    (TH1 cell numbering: bin = biny * (nx + 2) + binx)
+//    entries, and the statistics of TH1::GetStats()
+//
+// and compute the bin inline, with the expression of TAxis::FindBin(), so
+// every value lands in the bin ROOT would give it (NaN in the overflow).
+// The statistics follow TH1::Fill(): under/overflows do not count unless
+// TH1::StatOverflows() is set.
+//
+// ToTH1F() / ToTH2F() make the ROOT histogram only when it is needed, for
+// PlotHist, PlotHist2 or ROC: same name, title, binning, contents, errors,
+// entries and statistics as the TH1F/TH2F filled with the same values.
+//
+// A TH1F booked with xlow >= xhigh bins itself from its first entries. Such a
+// histogram keeps its values instead and fills them into the TH1F, in order,
+// on conversion, which gives the TH1F filled directly.
+
+// axis of FixedHist1/FixedHist2
+class FixedAxis {
+public :
+    FixedAxis(int n, double low, double high) : fN(n), fLow(low), fHigh(high) {}
+
+    // TAxis::FindBin() for fixed bins
+    int FindBin(double x) const
+    {
+        if (x < fLow)
+        {
+            return 0;
+        }
+        if (!(x < fHigh))
+        {
+            return fN + 1;
+        }
+        return 1 + int(fN * (x - fLow) / (fHigh - fLow));
+    }
+    bool InRange(int bin) const { return bin > 0 && bin <= fN; }
+    // true if ROOT bins this axis from the data
+    bool Automatic() const { return !(fLow < fHigh); }
+
+    int    fN;
+    double fLow;
+    double fHigh;
+};
+
+class FixedHist1 {
+public :
+    FixedHist1(const char *name, const char *title, int nx, double xlow, double xhigh)
+        : fName(name), fTitle(title), fX(nx, xlow, xhigh),
+          fSumw(nx + 2, 0.0), fSumw2(nx + 2, 0.0), fEntries(0), fWeighted(false),
+          fStatOverflows(TH1::StatOverflows())
+    {
+        for (auto &s : fStats) s = 0;
+    }
+
+    void Fill(double x) { Fill(x, 1.0); }
+    void Fill(double x, double w)
+    {
+        if (fX.Automatic())
+        {
+            fBuffer.push_back(x);
+            fBuffer.push_back(w);
+            return;
+        }
+        int bin = fX.FindBin(x);
+        ++fEntries;
+        fSumw[bin]  += w;
+        fSumw2[bin] += w * w;
+        fWeighted = fWeighted || w != 1.0;
+        if (!fStatOverflows && !fX.InRange(bin))
+        {
+            return;
+        }
+        fStats[0] += w;
+        fStats[1] += w * w;
+        fStats[2] += w * x;
+        fStats[3] += w * x * x;
+    }
+
+    // add a histogram booked with the same binning (TH1::Add)
+    void Add(const FixedHist1 *other)
+    {
+        for (size_t i = 0; i < fSumw.size(); ++i)
+        {
+            fSumw[i]  += other->fSumw[i];
+            fSumw2[i] += other->fSumw2[i];
+        }
+        for (int j = 0; j < kNStats; ++j)
+        {
+            fStats[j] += other->fStats[j];
+        }
+        fEntries += other->fEntries;
+        fWeighted = fWeighted || other->fWeighted;
+        fBuffer.insert(fBuffer.end(), other->fBuffer.begin(), other->fBuffer.end());
+    }
+
+    // a TH1F with the contents of this histogram, not attached to any directory
+    std::unique_ptr<TH1F> ToTH1F() const
+    {
+        std::unique_ptr<TH1F> hist(new TH1F(fName.c_str(), fTitle.c_str(), fX.fN, fX.fLow, fX.fHigh));
+        hist->SetDirectory(0);
+        if (fX.Automatic())
+        {
+            for (size_t i = 0; i < fBuffer.size(); i += 2)
+            {
+                hist->Fill(fBuffer[i], fBuffer[i + 1]);
+            }
+            return hist;
+        }
+        if (fWeighted && hist->GetSumw2N() == 0)
+        {
+            hist->Sumw2();
+        }
+        for (int bin = 0; bin < fX.fN + 2; ++bin)
+        {
+            hist->SetBinContent(bin, fSumw[bin]);
+            if (hist->GetSumw2N() > 0)
+            {
+                hist->SetBinError(bin, std::sqrt(fSumw2[bin]));
+            }
+        }
+        // after SetBinContent(), which resets them
+        double stats[kNStats];
+        for (int j = 0; j < kNStats; ++j)
+        {
+            stats[j] = fStats[j];
+        }
+        hist->PutStats(stats);
+        hist->SetEntries(fEntries);
+        return hist;
+    }
+
+private :
+    static const int kNStats = 4;  // sumw, sumw2, sumwx, sumwx2
+
+    std::string         fName;
+    std::string         fTitle;
+    FixedAxis           fX;
+    std::vector<double> fSumw;
+    std::vector<double> fSumw2;
+    double              fStats[kNStats];
+    double              fEntries;
+    bool                fWeighted;
+    bool                fStatOverflows;
+    std::vector<double> fBuffer;   // (x, w) pairs of an automatic binning
+};
+
+class FixedHist2 {
+public :
+    FixedHist2(const char *name, const char *title, int nx, double xlow, double xhigh, int ny, double ylow, double yhigh)
+        : fName(name), fTitle(title), fX(nx, xlow, xhigh), fY(ny, ylow, yhigh),
+          fSumw((nx + 2) * (ny + 2), 0.0), fSumw2((nx + 2) * (ny + 2), 0.0), fEntries(0), fWeighted(false),
+          fStatOverflows(TH1::StatOverflows())
+    {
+        for (auto &s : fStats) s = 0;
+    }
+
+    void Fill(double x, double y) { Fill(x, y, 1.0); }
+    void Fill(double x, double y, double w)
+    {
+        if (fX.Automatic() || fY.Automatic())
+        {
+            fBuffer.push_back(x);
+            fBuffer.push_back(y);
+            fBuffer.push_back(w);
+            return;
+        }
+        int binx = fX.FindBin(x);
+        int biny = fY.FindBin(y);
+        int bin  = biny * (fX.fN + 2) + binx;
+        ++fEntries;
+        fSumw[bin]  += w;
+        fSumw2[bin] += w * w;
+        fWeighted = fWeighted || w != 1.0;
+        if (!fStatOverflows && (!fX.InRange(binx) || !fY.InRange(biny)))
+        {
+            return;
+        }
+        fStats[0] += w;
+        fStats[1] += w * w;
+        fStats[2] += w * x;
+        fStats[3] += w * x * x;
+        fStats[4] += w * y;
+        fStats[5] += w * y * y;
+        fStats[6] += w * x * y;
+    }
+
+    // add a histogram booked with the same binning (TH1::Add)
+    void Add(const FixedHist2 *other)
+    {
+        for (size_t i = 0; i < fSumw.size(); ++i)
+        {
+            fSumw[i]  += other->fSumw[i];
+            fSumw2[i] += other->fSumw2[i];
+        }
+        for (int j = 0; j < kNStats; ++j)
+        {
+            fStats[j] += other->fStats[j];
+        }
+        fEntries += other->fEntries;
+        fWeighted = fWeighted || other->fWeighted;
+        fBuffer.insert(fBuffer.end(), other->fBuffer.begin(), other->fBuffer.end());
+    }
+
+    // a TH2F with the contents of this histogram, not attached to any directory
+    std::unique_ptr<TH2F> ToTH2F() const
+    {
+        std::unique_ptr<TH2F> hist(new TH2F(fName.c_str(), fTitle.c_str(), fX.fN, fX.fLow, fX.fHigh, fY.fN, fY.fLow, fY.fHigh));
+        hist->SetDirectory(0);
+        if (fX.Automatic() || fY.Automatic())
+        {
+            for (size_t i = 0; i < fBuffer.size(); i += 3)
+            {
+                hist->Fill(fBuffer[i], fBuffer[i + 1], fBuffer[i + 2]);
+            }
+            return hist;
+        }
+        if (fWeighted && hist->GetSumw2N() == 0)
+        {
+            hist->Sumw2();
+        }
+        for (int bin = 0; bin < (int) fSumw.size(); ++bin)
+        {
+            hist->SetBinContent(bin, fSumw[bin]);
+            if (hist->GetSumw2N() > 0)
+            {
+                hist->SetBinError(bin, std::sqrt(fSumw2[bin]));
+            }
+        }
+        // after SetBinContent(), which resets them
+        double stats[kNStats];
+        for (int j = 0; j < kNStats; ++j)
+        {
+            stats[j] = fStats[j];
+        }
+        hist->PutStats(stats);
+        hist->SetEntries(fEntries);
+        return hist;
+    }
+
+private :
+    static const int kNStats = 7;  // sumw, sumw2, sumwx, sumwx2, sumwy, sumwy2, sumwxy
+
+    std::string         fName;
+    std::string         fTitle;
+    FixedAxis           fX;
+    FixedAxis           fY;
+    std::vector<double> fSumw;
+    std::vector<double> fSumw2;
+    double              fStats[kNStats];
+    double              fEntries;
+    bool                fWeighted;
+    bool                fStatOverflows;
+    std::vector<double> fBuffer;   // (x, y, w) triples of an automatic binning
+};
+
+#endif
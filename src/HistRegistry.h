@@ -0,0 +1,113 @@
+#ifndef HistRegistry_h
+#define HistRegistry_h
+
+#include "FixedHist.h"
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// Name and binning of one histogram of a HistRegistry; ny is not used in 1D.
+struct HistSpec {
+    std::string name;
+    int         nx;
+    double      xlow;
+    double      xhigh;
+    int         ny;
+    double      ylow;
+    double      yhigh;
+};
+
+// name parts joined with '_', empty parts left out
+inline std::string HistName(std::initializer_list<std::string> parts)
+{
+    std::string name;
+    for (const auto &p : parts)
+    {
+        if (!p.empty())
+        {
+            name += (name.empty() ? "" : "_") + p;
+        }
+    }
+    return name;
+}
+
+// The histograms of a (category, flavour, variable, pT slice) cross-product.
+//
+// The constructor books every combination from a spec function, which gives
+// the name and binning of each one, into a single vector reserved up front;
+// a histogram is then reached by its index:
+//
+//    Index(c, f, v, s) = ((s * nCategories + c) * nFlavours + f) * nVariables + v
+//
+// so the variables of a (category, flavour, slice) row are adjacent, and a
+// loop fills a row with one index instead of a branch per histogram name.
+// The histograms do not move once booked: pointers into the registry stay
+// valid for its lifetime. H is FixedHist1 or FixedHist2 (see FixedHist.h);
+// the fill loops convert to TH1F/TH2F only to plot.
+template <class H>
+class HistRegistry {
+public :
+    typedef std::function<HistSpec(int category, int flavour, int variable, int slice)> Spec;
+
+    HistRegistry(int n_categories, int n_flavours, int n_variables, int n_slices, const Spec &spec)
+        : fNCategories(n_categories), fNFlavours(n_flavours), fNVariables(n_variables), fNSlices(n_slices)
+    {
+        fHists.reserve(n_categories * n_flavours * n_variables * n_slices);
+        for (int s = 0; s < n_slices; ++s)
+        {
+            for (int c = 0; c < n_categories; ++c)
+            {
+                for (int f = 0; f < n_flavours; ++f)
+                {
+                    for (int v = 0; v < n_variables; ++v)
+                    {
+                        Book(spec(c, f, v, s));
+                    }
+                }
+            }
+        }
+    }
+    HistRegistry(const HistRegistry &) = delete;
+    HistRegistry &operator=(const HistRegistry &) = delete;
+
+    int Index(int c, int f, int v, int s = 0) const { return ((s * fNCategories + c) * fNFlavours + f) * fNVariables + v; }
+    H  &At(int i) { return fHists[i]; }
+    H  &At(int c, int f, int v, int s = 0) { return fHists[Index(c, f, v, s)]; }
+    int Size() const { return (int) fHists.size(); }
+
+    void Fill(int i, double x) { fHists[i].Fill(x); }
+    void Fill(int i, double x, double y) { fHists[i].Fill(x, y); }
+
+    // add the histograms of a registry booked from the same spec
+    void Add(HistRegistry &other)
+    {
+        for (size_t i = 0; i < fHists.size(); ++i)
+        {
+            fHists[i].Add(&other.fHists[i]);
+        }
+    }
+
+private :
+    void Book(const HistSpec &s);
+
+    int            fNCategories;
+    int            fNFlavours;
+    int            fNVariables;
+    int            fNSlices;
+    std::vector<H> fHists;
+};
+
+template <>
+inline void HistRegistry<FixedHist1>::Book(const HistSpec &s)
+{
+    fHists.emplace_back(s.name.c_str(), s.name.c_str(), s.nx, s.xlow, s.xhigh);
+}
+
+template <>
+inline void HistRegistry<FixedHist2>::Book(const HistSpec &s)
+{
+    fHists.emplace_back(s.name.c_str(), s.name.c_str(), s.nx, s.xlow, s.xhigh, s.ny, s.ylow, s.yhigh);
+}
+
+#endif
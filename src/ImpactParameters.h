@@ -0,0 +1,167 @@
+#ifndef ImpactParameters_h
+#define ImpactParameters_h
+
+#include <Rtypes.h>
+#include <cmath>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Derived impact parameters of the LowPtElectron collection.
+//
+// For each electron, with -999 where an error is 0:
+//
+//    dxySig = dxy / dxyErr                               (dxyErr != 0)
+//    dzSig  = dz / dzErr                                 (dzErr != 0)
+//    IPSig1 = sqrt(dxySig^2 + dzSig^2)                   (both != 0)
+//    IP     = sqrt(dxy^2 + dz^2)                         (both != 0)
+//    IPErr  = sqrt(dxyErr^2 + dzErr^2)                   (both != 0)
+//    IPSig2 = |IP / IPErr|                               (dxyErr != 0)
+//    IPdiff = IPSig1 - IPSig2
+//
+// IPSig2 only tests dxyErr, as the loops always did: with dzErr == 0 it is
+// |-999 / -999| = 1.
+//
+// Compute() runs over contiguous dxy, dxyErr, dz and dzErr arrays (an event
+// of the leaf buffers, or a block of events of the ElectronCache columns) and
+// writes the seven columns. The SSE2 version computes four electrons at a
+// time and replaces the divisions by 0 with the sentinel by a mask, the
+// remaining ones go through ImpactParameter(), the scalar definition. Both
+// round every operation to float in the same order (no fused multiply-add,
+// see CMakeLists.txt), so the columns are bit-for-bit those of the scalar
+// code, sentinels and NaN included.
+class ImpactParameters {
+public :
+    // columns, from the first electron of the last Select()ed range
+    const float *dxySig;
+    const float *dzSig;
+    const float *IPSig1;
+    const float *IP;
+    const float *IPErr;
+    const float *IPSig2;
+    const float *IPdiff;
+
+    ImpactParameters() : fStride(0), fFirst(-1), fCount(0) { Select(0); }
+    ImpactParameters(const ImpactParameters &) = delete;
+    ImpactParameters &operator=(const ImpactParameters &) = delete;
+
+    // scalar definition, for electron i of the arrays
+    static void ImpactParameter(const float *dxy, const float *dxyErr, const float *dz, const float *dzErr, int i,
+                                float &dxySig, float &dzSig, float &IPSig1, float &IP, float &IPErr, float &IPSig2, float &IPdiff)
+    {
+        dxySig = -999;
+        // avoid dividing by 0
+        if (dxyErr[i] != 0)
+        {
+            dxySig = dxy[i] / dxyErr[i];
+        }
+        dzSig = -999;
+        if (dzErr[i] != 0)
+        {
+            dzSig = dz[i] / dzErr[i];
+        }
+        IPSig1 = -999;
+        IP     = -999;
+        IPErr  = -999;
+        if (dxyErr[i] != 0 && dzErr[i] != 0)
+        {
+            IPSig1 = std::sqrt(dxySig * dxySig + dzSig * dzSig);
+            IP     = std::sqrt(dxy[i] * dxy[i] + dz[i] * dz[i]);
+            IPErr  = std::sqrt(dxyErr[i] * dxyErr[i] + dzErr[i] * dzErr[i]);
+        }
+        IPSig2 = -999;
+        if (dxyErr[i] != 0)
+        {
+            IPSig2 = std::abs(IP / IPErr);
+        }
+        IPdiff = IPSig1 - IPSig2;
+    }
+
+    // Compute the n electrons of the arrays; first is the index of their first
+    // electron in the collection (Holds()), -1 if they are not to be reused.
+    void Compute(const float *dxy, const float *dxyErr, const float *dz, const float *dzErr, int n, Long64_t first = -1)
+    {
+        if ((int) fData.size() < kNColumns * n)
+        {
+            fData.resize(kNColumns * n);
+        }
+        fFirst = first;
+        fCount = n;
+        float *c[kNColumns];
+        for (int j = 0; j < kNColumns; ++j)
+        {
+            c[j] = fData.data() + j * n;
+        }
+        fStride = n;
+        int i = 0;
+#if defined(__SSE2__)
+        const __m128 zero     = _mm_setzero_ps();
+        const __m128 sentinel = _mm_set1_ps(-999);
+        const __m128 sign     = _mm_set1_ps(-0.0f);
+        // a where mask is set, b elsewhere
+        auto blend = [](__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); };
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 vdxy    = _mm_loadu_ps(dxy + i);
+            __m128 vdxyErr = _mm_loadu_ps(dxyErr + i);
+            __m128 vdz     = _mm_loadu_ps(dz + i);
+            __m128 vdzErr  = _mm_loadu_ps(dzErr + i);
+            // != is true for NaN, like the scalar comparison
+            __m128 hasDxy  = _mm_cmpneq_ps(vdxyErr, zero);
+            __m128 hasDz   = _mm_cmpneq_ps(vdzErr, zero);
+            __m128 hasBoth = _mm_and_ps(hasDxy, hasDz);
+
+            __m128 vdxySig = blend(hasDxy, _mm_div_ps(vdxy, vdxyErr), sentinel);
+            __m128 vdzSig  = blend(hasDz, _mm_div_ps(vdz, vdzErr), sentinel);
+            __m128 vIPSig1 = blend(hasBoth, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vdxySig, vdxySig), _mm_mul_ps(vdzSig, vdzSig))), sentinel);
+            __m128 vIP     = blend(hasBoth, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vdxy, vdxy), _mm_mul_ps(vdz, vdz))), sentinel);
+            __m128 vIPErr  = blend(hasBoth, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vdxyErr, vdxyErr), _mm_mul_ps(vdzErr, vdzErr))), sentinel);
+            __m128 vIPSig2 = blend(hasDxy, _mm_andnot_ps(sign, _mm_div_ps(vIP, vIPErr)), sentinel);
+
+            _mm_storeu_ps(c[0] + i, vdxySig);
+            _mm_storeu_ps(c[1] + i, vdzSig);
+            _mm_storeu_ps(c[2] + i, vIPSig1);
+            _mm_storeu_ps(c[3] + i, vIP);
+            _mm_storeu_ps(c[4] + i, vIPErr);
+            _mm_storeu_ps(c[5] + i, vIPSig2);
+            _mm_storeu_ps(c[6] + i, _mm_sub_ps(vIPSig1, vIPSig2));
+        }
+#endif
+        for (; i < n; ++i)
+        {
+            ImpactParameter(dxy, dxyErr, dz, dzErr, i, c[0][i], c[1][i], c[2][i], c[3][i], c[4][i], c[5][i], c[6][i]);
+        }
+        Select(first < 0 ? 0 : first);
+    }
+
+    // true if the electrons [first, first + n) of the collection were computed
+    bool Holds(Long64_t first, int n) const
+    {
+        return fFirst >= 0 && first >= fFirst && first + n <= fFirst + fCount;
+    }
+
+    // point the columns at electron first of the collection (of the computed range)
+    void Select(Long64_t first)
+    {
+        float *base = fData.empty() ? 0 : fData.data() + (fFirst >= 0 ? first - fFirst : 0);
+        dxySig = base;
+        dzSig  = base ? base + fStride     : 0;
+        IPSig1 = base ? base + 2 * fStride : 0;
+        IP     = base ? base + 3 * fStride : 0;
+        IPErr  = base ? base + 4 * fStride : 0;
+        IPSig2 = base ? base + 5 * fStride : 0;
+        IPdiff = base ? base + 6 * fStride : 0;
+    }
+
+private :
+    static const int kNColumns = 7;
+
+    std::vector<float> fData;    // kNColumns columns of fStride values
+    int                fStride;
+    Long64_t           fFirst;
+    int                fCount;
+};
+
+#endif
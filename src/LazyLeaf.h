@@ -0,0 +1,302 @@
+#ifndef LazyLeaf_h
+#define LazyLeaf_h
+
+#include <TBranch.h>
+#include <TTree.h>
+#include <TLeaf.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdio>
+
+#include "PhaseTimer.h"
+
+// Per-branch lazy loading for the analysis classes (see NanoReader.h).
+//
+// A LazyLeaf owns the buffer that SetBranchAddress() fills and reads its
+// branch the first time it is accessed in an event. It is also bound to its
+// branch only then: a leaf the analysis never reads never gets a branch
+// address, so a chain only sets up and re-sizes the branches in use. The
+// event is selected with LazyEntry::Set(ientry) after LoadTree(), instead of
+// a full fChain->GetEntry(jentry):
+//
+//    Long64_t ientry = LoadTree(jentry);
+//    if (ientry < 0) break;
+//    fLazyEntry.Set(ientry);
+//    for (int k = 0; k < nLowPtElectron; ++k)   // reads nLowPtElectron only
+//
+// Events with no electrons, or rejected before the isolation / impact
+// parameter cuts, never read those branches.
+// While no entry is set (Reset()), a LazyLeaf behaves like the plain array
+// and returns whatever the last GetEntry() put in the buffer; LazyEntry::
+// BindAll() connects every declared leaf first, so that GetEntry() fills them.
+//
+// The buffer is sized at run time. N is only the initial capacity; on each
+// new file (Notify()) LazyEntry::Fit() grows every bound buffer to the maximum
+// count of its leaf in that file and moves the branch address, so samples
+// with larger multiplicities than the file the class was generated from are
+// read without overruns.
+//
+// A LazyLeaf can also be mapped onto a column of an ElectronCache file
+// (Map()); while the entry is selected with LazyEntry::SetCached(), accesses
+// read the mapped column directly and the branch is never touched.
+//
+// With a PhaseTimer on the entry (SetTimer()), the branch reads of Load()
+// are charged to PhaseTimer::kRead.
+//
+// Reading a leaf whose branch is disabled (see BranchManifest.h) is an
+// error: ROOT would read nothing and leave the previous event's values in
+// the buffer. Load() reports the leaf once, returns zeros and marks the
+// entry failed; NanoReader::LoadEntry() then ends the loop.
+
+// Interface of LazyLeaf used by LazyEntry.
+class LazyLeafBase {
+public :
+    virtual ~LazyLeafBase() {}
+    virtual void Bind() = 0;
+    virtual void Unbind() = 0;
+    virtual void Fit(TTree *tree) = 0;
+};
+
+// Current entry of the tree, shared by all LazyLeaf members of a class.
+class LazyEntry {
+public :
+    LazyEntry() : fTree(0), fEntry(-1), fSerial(0), fActive(false), fCached(false), fFailed(false), fOffset(0), fBytes(0), fTimer(0) {}
+
+    // tree the leaves read from; a new tree drops the bindings to the old one
+    void SetTree(TTree *tree)
+    {
+        fTree = tree;
+        for (auto l : fLeaves)
+        {
+            l->Unbind();
+        }
+    }
+    TTree *Tree() const { return fTree; }
+
+    // select the entry (in the current tree) read by the next accesses
+    void Set(Long64_t ientry) { fEntry = ientry; ++fSerial; fActive = true; fCached = false; }
+    // select an event of a mapped cache; its first element is at offset
+    void SetCached(Long64_t entry, Long64_t offset) { fEntry = entry; fOffset = offset; fActive = false; fCached = true; }
+    // back to eager mode (fChain->GetEntry fills the buffers)
+    void Reset() { fEntry = -1; ++fSerial; fActive = false; fCached = false; }
+
+    Long64_t Entry() const { return fEntry; }
+    Long64_t Serial() const { return fSerial; }
+    bool IsActive() const { return fActive; }
+    bool IsCached() const { return fCached; }
+    Long64_t Offset() const { return fOffset; }
+    // a leaf read from a disabled branch: reported once, until TakeFailure()
+    void Fail(const std::string &leaf)
+    {
+        if (!fFailed)
+        {
+            printf("ERROR: LazyLeaf: %s is read but its branch is disabled; add it to the branch manifest. Stopping the loop.\n", leaf.c_str());
+        }
+        fFailed = true;
+    }
+    // true once after Fail(), which is then cleared for the next loop
+    bool TakeFailure()
+    {
+        bool failed = fFailed;
+        fFailed = false;
+        return failed;
+    }
+    // bytes read through LazyLeaf::Load() and NanoReader::GetEntry()
+    Long64_t Bytes() const { return fBytes; }
+    void AddBytes(Int_t nb) { fBytes += nb; }
+    // timer of the branch reads, or 0
+    void SetTimer(PhaseTimer *timer) { fTimer = timer; }
+    PhaseTimer *Timer() const { return fTimer; }
+
+    // leaves declared on this entry
+    void Register(LazyLeafBase *leaf)
+    {
+        for (auto l : fLeaves)
+        {
+            if (l == leaf) return;
+        }
+        fLeaves.push_back(leaf);
+    }
+    // bind every declared leaf, for a full fChain->GetEntry()
+    void BindAll()
+    {
+        for (auto l : fLeaves)
+        {
+            l->Bind();
+        }
+    }
+    // size the bound buffers for the tree currently loaded in tree (call from Notify())
+    void Fit(TTree *tree)
+    {
+        for (auto l : fLeaves)
+        {
+            l->Fit(tree);
+        }
+    }
+
+private :
+    std::vector<LazyLeafBase*> fLeaves;
+    TTree   *fTree;
+    Long64_t fEntry;
+    Long64_t fSerial;
+    bool     fActive;
+    bool     fCached;
+    bool     fFailed;
+    Long64_t fOffset;
+    Long64_t fBytes;
+    PhaseTimer *fTimer;
+};
+
+// Buffer of values of type T, read from its branch on first access.
+// N is the initial capacity; N = 1 is used for scalar leaves such as
+// nLowPtElectron.
+template <typename T, int N = 1>
+class LazyLeaf : public LazyLeafBase {
+public :
+    LazyLeaf() : fBuffer(new T[N]()), fSize(N), fBranch(0), fBound(false), fEntry(0), fLoaded(-1), fColumn(0), fPerElement(false) {}
+    ~LazyLeaf() { delete [] fBuffer; }
+    LazyLeaf(const LazyLeaf &) = delete;
+    LazyLeaf &operator=(const LazyLeaf &) = delete;
+
+    // Name the branch and join the shared entry. The branch address is set
+    // by Bind(), on the first read.
+    void Declare(const char *name, LazyEntry *entry)
+    {
+        fName   = name;
+        fEntry  = entry;
+        entry->Register(this);
+        Unbind();
+    }
+    const std::string &Name() const { return fName; }
+    T *Buffer() { return fBuffer; }
+    int Capacity() const { return fSize; }
+    bool IsBound() const { return fBound; }
+
+    // Size the buffer for the current file and give its address to the tree
+    // of the entry. Once per tree; a missing branch is reported by ROOT and
+    // leaves the buffer at its last values.
+    void Bind()
+    {
+        TTree *tree = fEntry ? fEntry->Tree() : 0;
+        if (fBound || !tree)
+        {
+            return;
+        }
+        fBound = true;
+        Grow(tree);
+        tree->SetBranchAddress(fName.c_str(), fBuffer, &fBranch);
+    }
+    void Unbind()
+    {
+        fBound  = false;
+        fBranch = 0;
+        fLoaded = -1;
+    }
+
+    // Grow the buffer to the largest value count of the leaf in the current
+    // file of tree and give the new address to the tree.
+    void Fit(TTree *tree)
+    {
+        if (fBound && Grow(tree))
+        {
+            tree->SetBranchAddress(fName.c_str(), fBuffer, &fBranch);
+        }
+    }
+
+    void Load()
+    {
+        if (!fEntry || !fEntry->IsActive() || fLoaded == fEntry->Serial())
+        {
+            return;
+        }
+        fLoaded = fEntry->Serial();
+        if (!fBound)
+        {
+            Bind();
+        }
+        if (fBranch && fBranch->TestBit(kDoNotProcess))
+        {
+            std::fill(fBuffer, fBuffer + fSize, T());
+            fEntry->Fail(fName);
+            return;
+        }
+        if (fBranch)
+        {
+            PhaseTimer *timer = fEntry->Timer();
+            PhaseTimer::Phase phase = timer ? timer->Switch(PhaseTimer::kRead) : PhaseTimer::kRead;
+            fEntry->AddBytes(fBranch->GetEntry(fEntry->Entry()));
+            if (timer) timer->Switch(phase);
+        }
+    }
+
+
+    // Read from a mapped column instead of the branch while the entry is
+    // cached: one value per event, or per element (indexed from the event
+    // offset) for arrays. Map(0, false) goes back to the branch.
+    void Map(const T *column, bool per_element)
+    {
+        fColumn     = column;
+        fPerElement = per_element;
+    }
+
+    const T &operator[](int i)
+    {
+        if (fColumn && fEntry && fEntry->IsCached())
+        {
+            return fColumn[(fPerElement ? fEntry->Offset() : fEntry->Entry()) + i];
+        }
+        Load();
+        return fBuffer[i];
+    }
+    operator const T &() { return (*this)[0]; }
+
+    // the values of the event, contiguous: the mapped column from the event
+    // offset (the next events follow), or the buffer
+    const T *Data()
+    {
+        if (fColumn && fEntry && fEntry->IsCached())
+        {
+            return fColumn + (fPerElement ? fEntry->Offset() : fEntry->Entry());
+        }
+        Load();
+        return fBuffer;
+    }
+    bool IsMapped() const { return fColumn != 0; }
+
+private :
+    // grow the buffer to the largest value count of the leaf in the current
+    // file of tree; true if it moved
+    bool Grow(TTree *tree)
+    {
+        TLeaf *leaf = tree ? tree->GetLeaf(fName.c_str()) : 0;
+        if (!leaf)
+        {
+            return false;
+        }
+        TLeaf *count = leaf->GetLeafCount();
+        int size = leaf->GetLenStatic() * (count ? count->GetMaximum() : 1);
+        if (size <= fSize)
+        {
+            return false;
+        }
+        printf("LazyLeaf: %s grows from %d to %d values.\n", fName.c_str(), fSize, size);
+        delete [] fBuffer;
+        fBuffer = new T[size]();
+        fSize   = size;
+        fLoaded = -1;
+        return true;
+    }
+
+    T          *fBuffer;
+    int         fSize;
+    std::string fName;
+    TBranch    *fBranch;  // set by the tree in SetBranchAddress(), and by a TChain on each new file
+    bool        fBound;
+    LazyEntry  *fEntry;
+    Long64_t    fLoaded;
+    const T    *fColumn;
+    bool        fPerElement;
+};
+
+#endif
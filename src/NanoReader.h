@@ -0,0 +1,368 @@
+#ifndef NanoReader_h
+#define NanoReader_h
+
+#include <TROOT.h>
+#include <TChain.h>
+#include <TFile.h>
+#include <TEntryList.h>
+#include <TSystem.h>
+
+#include "BranchManifest.h"
+#include "LazyLeaf.h"
+#include "ElectronCache.h"
+#include "EntryListCache.h"
+#include "PhaseTimer.h"
+#include "CutMask.h"
+#include "ImpactParameters.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <functional>
+#include <algorithm>
+
+// Reader of the NanoAOD Events tree shared by the analysis classes.
+//
+// The leaves are declared once, in NanoSchema.h, as LazyLeaf members that
+// are bound to their branch when first read (see LazyLeaf.h): Init() sets
+// no branch address, and on a new file of a chain only the branches in use
+// are re-sized. An analysis class derives from it, adds its methods and
+// calls Init() from its constructor:
+//
+//    class KUSU : public NanoReader {
+//    public :
+//       KUSU(TTree *tree=0);
+//       virtual void Loop(int n_threads = 1);
+//    };
+//
+// A leaf missing from NanoSchema.h is added there, with its type and an
+// initial capacity.
+//
+// fTimer.Enable() before a method times its loop: LoadEntry() and the
+// branch reads are charged by the reader, the loops mark their fill and plot
+// phases and print fTimer.Report() at the end.
+class NanoReader {
+public :
+   TTree          *fChain;   //!pointer to the analyzed TTree or TChain
+   Int_t           fCurrent; //!current Tree number in a TChain
+   LazyEntry       fLazyEntry; //!entry read on demand by the LazyLeaf members
+   ElectronCache  *fCache;     //!mapped LowPtElectron columns, if UseCache() was called
+   TEntryList     *fPreselection; //!entries passing UsePreselection(), set on fChain
+   std::string     fOutputDir;    //!if set, replaces the output directories of the methods (see OutputDir())
+   PhaseTimer      fTimer;        //!wall time of the loops by phase, once enabled (see PhaseTimer.h)
+   ImpactParameters fIP;          //!derived impact parameters of the current event (see EventImpactParameters())
+
+   // Declaration of leaf types
+#define NANO_LEAF(type, name, capacity) LazyLeaf<type, capacity> name;
+#include "NanoSchema.h"
+#undef NANO_LEAF
+
+   // event selection for UsePreselection(); definition is the cache key
+   struct Preselection {
+      std::string           definition;
+      std::function<bool()> pass;
+   };
+
+   NanoReader();
+   virtual ~NanoReader();
+   virtual Int_t        Cut(Long64_t entry);
+   virtual std::vector<std::string> CutBranches();
+   virtual Int_t        GetEntry(Long64_t entry);
+   virtual Long64_t     LoadTree(Long64_t entry);
+   virtual Long64_t     LoadEntry(Long64_t entry);
+   virtual Long64_t     NumEntries();
+   virtual void         Init(TTree *tree);
+   virtual Bool_t       UseCache(std::string path);
+   virtual Bool_t       UsePreselection(std::string name, std::string dir = "");
+   virtual std::map<std::string, Preselection> Preselections();
+   virtual std::string  OutputDir(std::string dir);
+   UInt_t               ElectronCuts(int k, float IPSig1, float dzSig, const ElectronCutThresholds &t, UInt_t required = 0);
+   const ImpactParameters &EventImpactParameters();
+   ElectronValues       ElectronValuesOf(int k, float dxySig, float dzSig, float IPSig1, float IP, float IPErr, float IPSig2, float IPdiff);
+   virtual Bool_t       Notify();
+   virtual void         Show(Long64_t entry = -1);
+};
+
+// The definitions are inline: each analysis class compiles them, and several
+// classes can be loaded in one ROOT session.
+inline NanoReader::NanoReader() : fChain(0), fCurrent(-1), fCache(0), fPreselection(0)
+{
+   fLazyEntry.SetTimer(&fTimer);
+#define NANO_LEAF(type, name, capacity) name.Declare(#name, &fLazyEntry);
+#include "NanoSchema.h"
+#undef NANO_LEAF
+}
+
+inline NanoReader::~NanoReader()
+{
+   delete fCache;
+   if (fPreselection) {
+      if (fChain) fChain->SetEntryList(0);
+      delete fPreselection;
+   }
+   if (!fChain) return;
+   delete fChain->GetCurrentFile();
+}
+
+inline Int_t NanoReader::GetEntry(Long64_t entry)
+{
+// Read contents of entry: every leaf of NanoSchema.h. The read is charged
+// to PhaseTimer::kRead.
+   if (!fChain) return 0;
+   fLazyEntry.Reset();
+   fLazyEntry.BindAll();
+   fTimer.Switch(PhaseTimer::kRead);
+   Int_t nb = fChain->GetEntry(entry);
+   if (nb > 0) fLazyEntry.AddBytes(nb);
+   fTimer.Event(fLazyEntry.Bytes());
+   fTimer.Switch(PhaseTimer::kCompute);
+   return nb;
+}
+inline Long64_t NanoReader::LoadTree(Long64_t entry)
+{
+// Set the environment to read one entry
+   if (!fChain) return -5;
+   Long64_t centry = fChain->LoadTree(entry);
+   if (centry < 0) return centry;
+   if (fChain->GetTreeNumber() != fCurrent) {
+      fCurrent = fChain->GetTreeNumber();
+      Notify();
+   }
+   return centry;
+}
+inline Long64_t NanoReader::LoadEntry(Long64_t entry)
+{
+// Select entry for the LazyLeaf members: from the ElectronCache if UseCache()
+// was called, otherwise from the chain (branches are read on first access).
+// Returns -1, ending the loop, after a read from a disabled branch.
+// The time until it returns is charged to PhaseTimer::kLoadTree, what follows
+// to kCompute.
+   // a leaf of the last entry was read from a disabled branch: end the loop
+   if (fLazyEntry.TakeFailure()) return -1;
+   fTimer.Switch(PhaseTimer::kLoadTree);
+   Long64_t centry = -1;
+   if (fCache) {
+      centry = fCache->Select(entry, fLazyEntry);
+   } else {
+      // with a preselection, entry counts the selected entries
+      if (fChain->GetEntryList()) entry = fChain->GetEntryNumber(entry);
+      if (entry >= 0) centry = LoadTree(entry);
+      if (centry >= 0) fLazyEntry.Set(centry);
+   }
+   if (centry >= 0) fTimer.Event(fLazyEntry.Bytes());
+   fTimer.Switch(PhaseTimer::kCompute);
+   return centry;
+}
+inline Long64_t NanoReader::NumEntries()
+{
+// Number of entries LoadEntry() runs over: the events of the cache, the
+// entries passing the preselection, or all entries of the chain.
+   if (fCache) return fCache->Entries();
+   if (fChain->GetEntryList()) return fChain->GetEntryList()->GetN();
+   return fChain->GetEntriesFast();
+}
+
+inline void NanoReader::Init(TTree *tree)
+{
+   // The Init() function is called when the selector needs to initialize
+   // a new tree or chain. No branch address is set here: each LazyLeaf
+   // sets its own on first access, or GetEntry() sets them all.
+   if (!tree) return;
+   fChain = tree;
+   fCurrent = -1;
+   fChain->SetMakeClass(1);
+   fLazyEntry.SetTree(fChain);
+   Notify();
+}
+
+inline Bool_t NanoReader::UseCache(std::string path)
+{
+   // Run the loops from the columns of an ElectronCache file (see
+   // ElectronCache.h) instead of the chain; an empty path goes back to the
+   // chain. The leaves with a column in the cache are mapped, every other
+   // member keeps reading the chain.
+   delete fCache;
+   fCache = 0;
+   fLazyEntry.Reset();
+   if (path.empty()) return kTRUE;
+   fCache = new ElectronCache();
+   if (!fCache->Open(path)) {
+      delete fCache;
+      fCache = 0;
+      return kFALSE;
+   }
+#define NANO_LEAF(type, name, capacity) if (fCache->Has(#name)) fCache->Attach(#name, name);
+#include "NanoSchema.h"
+#undef NANO_LEAF
+   printf("Using cache %s: %lld events, %lld electrons.\n", path.c_str(), fCache->Entries(), fCache->Elements());
+   return kTRUE;
+}
+
+inline Bool_t NanoReader::Notify()
+{
+   // The Notify() function is called when a new file is opened. This
+   // can be either for a new TTree in a TChain or when when a new TTree
+   // is started when using PROOF. The return value is currently not used.
+
+   // size the bound leaf buffers for the multiplicities of the new file
+   fLazyEntry.Fit(fChain);
+   return kTRUE;
+}
+
+inline void NanoReader::Show(Long64_t entry)
+{
+// Print contents of entry.
+// If entry is not specified, print current entry
+   if (!fChain) return;
+   fChain->Show(entry);
+}
+inline Int_t NanoReader::Cut(Long64_t entry)
+{
+// This function may be called from Loop.
+// returns  1 if entry is accepted.
+// returns -1 otherwise.
+// It is the first stage of the event read: the loops call it after
+// LoadEntry() and before touching any LowPtElectron payload, so only the
+// branches it uses (CutBranches()) are read for rejected events.
+   if (nLowPtElectron == 0) return -1;
+   return 1;
+}
+
+inline UInt_t NanoReader::ElectronCuts(int k, float IPSig1, float dzSig, const ElectronCutThresholds &t, UInt_t required)
+{
+// Atomic cuts of electron k, one ElectronCut bit each (see CutMask.h). The
+// cuts are evaluated in bit order and evaluation stops at the first failing
+// cut in required, so a rejected electron reads no further branches.
+   UInt_t bits = 0;
+   auto set = [&bits, required](UInt_t bit, bool pass) {
+      if (pass) bits |= bit;
+      return pass || !(required & bit);
+   };
+   if (!set(kCutPtWindow, LowPtElectron_pt[k] >= t.lower_pt && LowPtElectron_pt[k] < t.higher_pt)) return bits;
+   if (!set(kCutConvVeto, LowPtElectron_convVeto[k] == 1)) return bits;
+   if (!set(kCutEta,      std::abs(LowPtElectron_eta[k]) < 2.4)) return bits;
+   if (!set(kCutIDLoose,  LowPtElectron_embeddedID[k] >= t.id_loose)) return bits;
+   if (!set(kCutID,       LowPtElectron_embeddedID[k] >= t.id)) return bits;
+   if (!set(kCutIso,      LowPtElectron_miniPFRelIso_all[k] < 4)) return bits;
+   if (!set(kCutDxy,      std::abs(LowPtElectron_dxy[k]) < 0.05)) return bits;
+   if (!set(kCutDz,       std::abs(LowPtElectron_dz[k]) < 0.1)) return bits;
+   if (!set(kCutIPSig1,   IPSig1 < 2)) return bits;
+   set(kCutDzSig, std::abs(dzSig) < 2);
+   return bits;
+}
+
+inline const ImpactParameters &NanoReader::EventImpactParameters()
+{
+// dxySig, dzSig, IPSig1, IP, IPErr, IPSig2 and IPdiff of the electrons of the
+// current event, indexed like the LowPtElectron leaves (see ImpactParameters.h).
+// From the chain, the event's electrons are computed at once; from a cache,
+// a block of events is computed when the event is not in the last one.
+   const int kBlock = 4096;
+   int n = nLowPtElectron;
+   if (fLazyEntry.IsCached() && LowPtElectron_dxy.IsMapped() && LowPtElectron_dxyErr.IsMapped() &&
+       LowPtElectron_dz.IsMapped() && LowPtElectron_dzErr.IsMapped()) {
+      Long64_t offset = fLazyEntry.Offset();
+      if (!fIP.Holds(offset, n)) {
+         int count = (int) std::min<Long64_t>(std::max(n, kBlock), fCache->Elements() - offset);
+         fIP.Compute(LowPtElectron_dxy.Data(), LowPtElectron_dxyErr.Data(), LowPtElectron_dz.Data(), LowPtElectron_dzErr.Data(),
+                     count, offset);
+      }
+      fIP.Select(offset);
+   } else {
+      fIP.Compute(LowPtElectron_dxy.Data(), LowPtElectron_dxyErr.Data(), LowPtElectron_dz.Data(), LowPtElectron_dzErr.Data(), n);
+   }
+   return fIP;
+}
+
+inline ElectronValues NanoReader::ElectronValuesOf(int k, float dxySig, float dzSig, float IPSig1, float IP, float IPErr, float IPSig2, float IPdiff)
+{
+// Values of electron k for ElectronHists::Fill().
+   return {LowPtElectron_embeddedID[k], LowPtElectron_eta[k], LowPtElectron_pt[k], LowPtElectron_dxy[k], LowPtElectron_dz[k],
+           LowPtElectron_dzErr[k], LowPtElectron_dxyErr[k], dzSig, dxySig, IPSig1, float(LowPtElectron_convVeto[k]),
+           LowPtElectron_miniPFRelIso_all[k], IPdiff, IPSig2, IP, IPErr, int(LowPtElectron_genPartFlav[k])};
+}
+
+inline std::vector<std::string> NanoReader::CutBranches()
+{
+// Branches read by Cut(); the loops add them to their manifest.
+   return {"nLowPtElectron"};
+}
+
+// Directory a method writes to: dir, its built-in default, unless fOutputDir
+// is set (the output argument of the executables, see RunMain.h). A trailing
+// '/' of dir is kept, as the methods append file names to it directly.
+inline std::string NanoReader::OutputDir(std::string dir)
+{
+    if (fOutputDir.empty())
+    {
+        return dir;
+    }
+    gSystem->mkdir(fOutputDir.c_str(), kTRUE);
+    if (!dir.empty() && dir.back() == '/')
+    {
+        return fOutputDir + "/";
+    }
+    return fOutputDir;
+}
+
+// Preselections known to UsePreselection(), by name. A class adds its own
+// by extending the map of the base.
+inline std::map<std::string, NanoReader::Preselection> NanoReader::Preselections()
+{
+    return {
+        {"eta_convveto", {"any LowPtElectron: abs(eta) < 2.4 && convVeto == 1", [this]()
+            {
+                for (int k = 0; k < nLowPtElectron; ++k)
+                {
+                    if (abs(LowPtElectron_eta[k]) < 2.4 && LowPtElectron_convVeto[k] == 1) return true;
+                }
+                return false;
+            }}},
+    };
+}
+
+// Restrict the loops to the entries passing the preselection name. The entry
+// lists are computed once per input file and kept in dir (see
+// EntryListCache.h), by default entry_lists/ in the output directory (see
+// OutputDir()); an empty name runs over all entries again. The definition
+// string is the cache key: change it with the selection code.
+inline Bool_t NanoReader::UsePreselection(std::string name, std::string dir)
+{
+    if (fPreselection)
+    {
+        fChain->SetEntryList(0);
+        delete fPreselection;
+        fPreselection = 0;
+    }
+    if (name.empty())
+    {
+        return kTRUE;
+    }
+    if (fCache)
+    {
+        printf("ERROR: UsePreselection: not available when running from a cache.\n");
+        return kFALSE;
+    }
+    std::map<std::string, Preselection> preselections = Preselections();
+    auto it = preselections.find(name);
+    if (it == preselections.end())
+    {
+        printf("ERROR: UsePreselection: unknown preselection '%s'.\n", name.c_str());
+        return kFALSE;
+    }
+    if (dir.empty())
+    {
+        dir = fOutputDir.empty() ? "entry_lists" : fOutputDir + "/entry_lists";
+    }
+    EntryListCache lists(dir);
+    fPreselection = lists.Select(fChain, it->second.definition, [this](Long64_t entry) { return LoadEntry(entry); }, it->second.pass);
+    if (!fPreselection)
+    {
+        return kFALSE;
+    }
+    fChain->SetEntryList(fPreselection);
+    return kTRUE;
+}
+
+#endif
@@ -0,0 +1,56 @@
+// Leaves of the NanoAOD Events tree read by the analysis classes.
+//
+// Each line is NANO_LEAF(type, name, capacity); the includer defines
+// NANO_LEAF before including this file (no include guard), see NanoReader.h.
+// capacity is the initial size of the buffer, grown per file to the largest
+// count of the leaf (see LazyLeaf.h). A collection is added with its counter
+// and the leaves the analysis reads; other branches of the file are ignored.
+// python/makeReader.py writes this file from branch patterns and a sample.
+
+// event
+NANO_LEAF(UInt_t,    run,                              1)
+NANO_LEAF(UInt_t,    luminosityBlock,                  1)
+NANO_LEAF(ULong64_t, event,                            1)
+
+// generated particles
+NANO_LEAF(UInt_t,    nGenPart,                         1)
+NANO_LEAF(Float_t,   GenPart_eta,                      157)
+NANO_LEAF(Float_t,   GenPart_mass,                     157)
+NANO_LEAF(Float_t,   GenPart_phi,                      157)
+NANO_LEAF(Float_t,   GenPart_pt,                       157)
+NANO_LEAF(Int_t,     GenPart_genPartIdxMother,         157)
+NANO_LEAF(Int_t,     GenPart_pdgId,                    157)
+NANO_LEAF(Int_t,     GenPart_status,                   157)
+NANO_LEAF(Int_t,     GenPart_statusFlags,              157)
+
+// low pt electrons
+NANO_LEAF(UInt_t,    nLowPtElectron,                   1)
+NANO_LEAF(Float_t,   LowPtElectron_ID,                 8)
+NANO_LEAF(Float_t,   LowPtElectron_convVtxRadius,      8)
+NANO_LEAF(Float_t,   LowPtElectron_deltaEtaSC,         8)
+NANO_LEAF(Float_t,   LowPtElectron_dxy,                8)
+NANO_LEAF(Float_t,   LowPtElectron_dxyErr,             8)
+NANO_LEAF(Float_t,   LowPtElectron_dz,                 8)
+NANO_LEAF(Float_t,   LowPtElectron_dzErr,              8)
+NANO_LEAF(Float_t,   LowPtElectron_eInvMinusPInv,      8)
+NANO_LEAF(Float_t,   LowPtElectron_embeddedID,         8)
+NANO_LEAF(Float_t,   LowPtElectron_energyErr,          8)
+NANO_LEAF(Float_t,   LowPtElectron_eta,                8)
+NANO_LEAF(Float_t,   LowPtElectron_hoe,                8)
+NANO_LEAF(Float_t,   LowPtElectron_mass,               8)
+NANO_LEAF(Float_t,   LowPtElectron_miniPFRelIso_all,   8)
+NANO_LEAF(Float_t,   LowPtElectron_miniPFRelIso_chg,   8)
+NANO_LEAF(Float_t,   LowPtElectron_phi,                8)
+NANO_LEAF(Float_t,   LowPtElectron_pt,                 8)
+NANO_LEAF(Float_t,   LowPtElectron_ptbiased,           8)
+NANO_LEAF(Float_t,   LowPtElectron_r9,                 8)
+NANO_LEAF(Float_t,   LowPtElectron_scEtOverPt,         8)
+NANO_LEAF(Float_t,   LowPtElectron_sieie,              8)
+NANO_LEAF(Float_t,   LowPtElectron_unbiased,           8)
+NANO_LEAF(Int_t,     LowPtElectron_charge,             8)
+NANO_LEAF(Int_t,     LowPtElectron_convWP,             8)
+NANO_LEAF(Int_t,     LowPtElectron_pdgId,              8)
+NANO_LEAF(Bool_t,    LowPtElectron_convVeto,           8)
+NANO_LEAF(UChar_t,   LowPtElectron_lostHits,           8)
+NANO_LEAF(Int_t,     LowPtElectron_genPartIdx,         8)
+NANO_LEAF(UChar_t,   LowPtElectron_genPartFlav,        8)
@@ -0,0 +1,137 @@
+#ifndef PhaseTimer_h
+#define PhaseTimer_h
+
+#include <Rtypes.h>
+#include <chrono>
+#include <cstdio>
+
+// Wall time of an event loop, split by phase.
+//
+// The loop switches the current phase as it goes; each Switch() charges the
+// time since the previous one to the phase that was running, so a switch
+// costs one clock read and phases never overlap:
+//
+//    LoadEntry(jentry);                          // kLoadTree, then kCompute
+//    ... cuts and per-electron values ...        // kCompute, with the branch
+//                                                // reads of LazyLeaf as kRead
+//    fTimer.Switch(PhaseTimer::kFill);
+//    ... histogram fills ...
+//    fTimer.Switch(PhaseTimer::kCompute);
+//
+// Report() prints events/s, the decompressed MB/s read by the LazyLeaf
+// members and the share of each phase; with Enable(n), a shorter line is
+// printed every n events. A disabled timer (the default) only tests a flag.
+class PhaseTimer {
+public :
+    enum Phase { kOther, kLoadTree, kRead, kCompute, kFill, kPlot, kNPhases };
+
+    PhaseTimer() : fEnabled(false), fEvery(0) { Reset(); }
+
+    // start timing from now; report_every > 0 prints progress every that many events
+    void Enable(Long64_t report_every = 0)
+    {
+        fEnabled = true;
+        fEvery   = report_every;
+        Reset();
+    }
+    void Disable() { fEnabled = false; }
+    bool IsEnabled() const { return fEnabled; }
+    Long64_t Every() const { return fEvery; }
+
+    void Reset()
+    {
+        for (int p = 0; p < kNPhases; ++p)
+        {
+            fSeconds[p] = 0;
+        }
+        fPhase  = kOther;
+        fEvents = 0;
+        fBytes  = 0;
+        fStart  = fLast = std::chrono::steady_clock::now();
+    }
+
+    // charge the time since the last switch to the running phase and start
+    // phase; returns the phase that was running
+    Phase Switch(Phase phase)
+    {
+        if (!fEnabled)
+        {
+            return phase;
+        }
+        auto now = std::chrono::steady_clock::now();
+        fSeconds[fPhase] += std::chrono::duration<double>(now - fLast).count();
+        fLast = now;
+        Phase previous = fPhase;
+        fPhase = phase;
+        return previous;
+    }
+
+    // count an event; bytes is the running total of bytes read by the loop
+    void Event(Long64_t bytes)
+    {
+        if (!fEnabled)
+        {
+            return;
+        }
+        ++fEvents;
+        fBytes = bytes;
+        if (fEvery > 0 && fEvents % fEvery == 0)
+        {
+            double seconds = Elapsed();
+            printf("PhaseTimer: %lld events, %.0f events/s, %.1f MB/s\n",
+                   fEvents, fEvents / seconds, fBytes / 1e6 / seconds);
+        }
+    }
+
+    // add the phases, events and bytes of other (e.g. a worker thread)
+    void Add(const PhaseTimer &other)
+    {
+        for (int p = 0; p < kNPhases; ++p)
+        {
+            fSeconds[p] += other.fSeconds[p];
+        }
+        fEvents += other.fEvents;
+        fBytes  += other.fBytes;
+    }
+
+    // events counted by Event(), the workers' included once added
+    Long64_t Events() const { return fEvents; }
+
+    double Elapsed() const { return std::chrono::duration<double>(std::chrono::steady_clock::now() - fStart).count(); }
+
+    void Report(const char *label)
+    {
+        if (!fEnabled)
+        {
+            return;
+        }
+        Switch(fPhase);
+        static const char *names[kNPhases] = {"other", "LoadTree", "read", "compute", "fill", "plot"};
+        double total = 0;
+        for (int p = 0; p < kNPhases; ++p)
+        {
+            total += fSeconds[p];
+        }
+        double seconds = Elapsed();
+        printf("PhaseTimer: %s: %lld events in %.2f s, %.0f events/s, %.1f MB decompressed, %.1f MB/s\n",
+               label, fEvents, seconds, fEvents / seconds, fBytes / 1e6, fBytes / 1e6 / seconds);
+        printf("PhaseTimer: %s:", label);
+        for (int p = 0; p < kNPhases; ++p)
+        {
+            printf(" %s %.1f%% (%.2f s)", names[p], total > 0 ? 100 * fSeconds[p] / total : 0.0, fSeconds[p]);
+        }
+        printf("\n");
+    }
+
+private :
+    bool     fEnabled;
+    Long64_t fEvery;
+    Phase    fPhase;
+    double   fSeconds[kNPhases];
+    Long64_t fEvents;
+    Long64_t fBytes;
+    std::chrono::steady_clock::time_point fStart;
+    std::chrono::steady_clock::time_point fLast;
+};
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef RocCurve_h
+#define RocCurve_h
+
+#include <TH1.h>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+// ROC curve of a signal and a background score histogram.
+//
+// Point i keeps the bins from nbins - i to nbins (a cut on the score at the
+// lower edge of bin nbins - i), i = 0 .. nbins - 1, so the last point is
+// (1, 1):
+//
+//    tpr[i] = signal integral of those bins / signal integral of 1 .. nbins
+//    fpr[i] = same for the background
+//
+// One pass from the top bin down accumulates both integrals, so the curve
+// costs O(nbins) instead of one Integral() per point; fine score binnings
+// (1e5 bins and more) are cheap. Under/overflows are left out, as in
+// Integral(1, nbins).
+struct RocCurve
+{
+    std::vector<double> tpr;  // signal efficiency
+    std::vector<double> fpr;  // background efficiency
+
+    bool Empty() const { return tpr.empty(); }
+
+    // area under the curve, trapezoids from (0, 0)
+    double AUC() const
+    {
+        double area = 0;
+        double x = 0;
+        double y = 0;
+        for (size_t i = 0; i < tpr.size(); ++i)
+        {
+            area += (fpr[i] - x) * (tpr[i] + y) / 2;
+            x = fpr[i];
+            y = tpr[i];
+        }
+        return area;
+    }
+
+    // signal efficiency at background efficiency bkg_rate: the last point at
+    // or below it (from (0, 0)), linear to the next one
+    double SignalEfficiencyAt(double bkg_rate) const
+    {
+        size_t i = std::upper_bound(fpr.begin(), fpr.end(), bkg_rate) - fpr.begin();
+        if (i == fpr.size())
+        {
+            return tpr.empty() ? 0 : tpr.back();
+        }
+        double x0 = i > 0 ? fpr[i - 1] : 0;
+        double y0 = i > 0 ? tpr[i - 1] : 0;
+        return y0 + (tpr[i] - y0) * (bkg_rate - x0) / (fpr[i] - x0);
+    }
+};
+
+// The RocCurve of nbins bins, bin i (1 .. nbins) holding sig(i) signal and
+// bkg(i) background; empty, with an error, if either has nothing in range.
+template <class Sig, class Bkg>
+inline RocCurve CumulativeRoc(int nbins, Sig sig, Bkg bkg)
+{
+    RocCurve roc;
+
+    // cumulative integrals from the top bin down, then the fractions
+    roc.tpr.resize(nbins);
+    roc.fpr.resize(nbins);
+    double sig_sum = 0;
+    double bkg_sum = 0;
+    for (int i = 0; i < nbins; ++i)
+    {
+        sig_sum += sig(nbins - i);
+        bkg_sum += bkg(nbins - i);
+        roc.tpr[i] = sig_sum;
+        roc.fpr[i] = bkg_sum;
+    }
+    if (sig_sum == 0 || bkg_sum == 0)
+    {
+        printf("ERROR: CumulativeRoc: empty %s histogram.\n", sig_sum == 0 ? "signal" : "background");
+        return RocCurve();
+    }
+    for (int i = 0; i < nbins; ++i)
+    {
+        roc.tpr[i] /= sig_sum;
+        roc.fpr[i] /= bkg_sum;
+    }
+    return roc;
+}
+
+// The RocCurve of sigHist against bkgHist; empty, with an error, if the binnings
+// differ or a histogram has no entries in range.
+inline RocCurve CumulativeRoc(const TH1 &sigHist, const TH1 &bkgHist)
+{
+    int nbins = sigHist.GetNbinsX();
+    if (bkgHist.GetNbinsX() != nbins)
+    {
+        printf("ERROR: CumulativeRoc: %d signal bins but %d background bins.\n", nbins, bkgHist.GetNbinsX());
+        return RocCurve();
+    }
+    return CumulativeRoc(nbins, [&](int bin) { return sigHist.GetBinContent(bin); },
+                         [&](int bin) { return bkgHist.GetBinContent(bin); });
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef RunMain_h
+#define RunMain_h
+
+#include <TROOT.h>
+#include <TChain.h>
+#include <TFile.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <functional>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <sys/resource.h>
+
+// Command line driver of the compiled analysis executables (see
+// CMakeLists.txt): runKUSU, runTTJETS and runNanoClass.
+//
+//    runTTJETS [options] <method> <output dir> <input files...>
+//
+// Inputs are NanoAOD files, or text files (.txt) listing one file per line.
+// Options:
+//    -j <n>               threads, for the methods that use them
+//    --cache <path>       run from an ElectronCache file (see ElectronCache.h)
+//    --preselection <n>   restrict to a preselection (see UsePreselection())
+//    --report-every <n>   print the rate every n events (see PhaseTimer.h)
+//
+// Each executable passes the methods it exposes, by name; a method gets the
+// reader and the options. At the end, a line starting with "RunMain:" gives
+// the events processed (loaded by LoadEntry(), as counted by the reader's
+// PhaseTimer) and in the input, the wall time, the bytes read from the files
+// and the peak resident memory (used by benchmark.sh). The rate is that of
+// the events processed: a method may stop early (Graph() reads at most
+// 150000). The PhaseTimer is enabled, so the loops also print the time spent
+// in each phase.
+struct RunOptions {
+    int         threads = 1;
+    std::string cache;
+    std::string preselection;
+    Long64_t    report_every = 0;
+};
+
+template <typename T>
+using RunMethods = std::map<std::string, std::function<void(T&, const RunOptions&)>>;
+
+inline void RunUsage(const char *program, const std::vector<std::string> &methods)
+{
+    printf("usage: %s [-j threads] [--cache path] [--preselection name] [--report-every n] <method> <output dir> <input files or .txt lists...>\n", program);
+    printf("methods:");
+    for (const auto &m : methods)
+    {
+        printf(" %s", m.c_str());
+    }
+    printf("\n");
+}
+
+template <typename T>
+int RunMain(int argc, char **argv, const RunMethods<T> &methods)
+{
+    std::vector<std::string> names;
+    for (const auto &m : methods)
+    {
+        names.push_back(m.first);
+    }
+    RunOptions options;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if ((arg == "-j" || arg == "--cache" || arg == "--preselection" || arg == "--report-every") && i + 1 < argc)
+        {
+            std::string value = argv[++i];
+            if (arg == "-j")                    options.threads = std::atoi(value.c_str());
+            else if (arg == "--cache")          options.cache = value;
+            else if (arg == "--report-every")   options.report_every = std::atoll(value.c_str());
+            else                                options.preselection = value;
+        }
+        else if (arg == "-h" || arg == "--help")
+        {
+            RunUsage(argv[0], names);
+            return 0;
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+    if (args.size() < 3)
+    {
+        RunUsage(argv[0], names);
+        return 1;
+    }
+    auto method = methods.find(args[0]);
+    if (method == methods.end())
+    {
+        printf("ERROR: unknown method '%s'.\n", args[0].c_str());
+        RunUsage(argv[0], names);
+        return 1;
+    }
+
+    gROOT->SetBatch(kTRUE);
+    TChain *chain = new TChain("Events");
+    for (size_t i = 2; i < args.size(); ++i)
+    {
+        const std::string &input = args[i];
+        if (input.size() > 4 && input.compare(input.size() - 4, 4, ".txt") == 0)
+        {
+            std::ifstream list(input);
+            if (!list.is_open())
+            {
+                printf("ERROR: cannot open file list %s.\n", input.c_str());
+                return 1;
+            }
+            std::string line;
+            while (std::getline(list, line))
+            {
+                if (!line.empty() && line[0] != '#')
+                {
+                    chain->Add(line.c_str());
+                }
+            }
+        }
+        else
+        {
+            chain->Add(input.c_str());
+        }
+    }
+    if (chain->GetListOfFiles()->GetEntries() == 0)
+    {
+        printf("ERROR: no input files.\n");
+        return 1;
+    }
+
+    T *reader = new T(chain);
+    reader->fOutputDir = args[1];
+    if (!options.cache.empty() && !reader->UseCache(options.cache))
+    {
+        return 1;
+    }
+    if (!options.preselection.empty() && !reader->UsePreselection(options.preselection))
+    {
+        return 1;
+    }
+    Long64_t n_input = (reader->fCache || chain->GetEntryList()) ? reader->NumEntries() : chain->GetEntries();
+    reader->fTimer.Enable(options.report_every);
+    Long64_t bytes_start = TFile::GetFileBytesRead();
+    auto start = std::chrono::steady_clock::now();
+    method->second(*reader, options);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double mb_read = (TFile::GetFileBytesRead() - bytes_start) / 1e6;
+    Long64_t n_events = reader->fTimer.Events();
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    printf("RunMain: %s %s: %lld events of %lld in %.2f s, %.0f events/s, %.1f MB read, %.1f MB/s, peak RSS %.0f MB\n",
+           argv[0], args[0].c_str(), n_events, n_input, seconds, n_events / seconds, mb_read, mb_read / seconds, usage.ru_maxrss / 1024.0);
+
+    // the chain owns its files: detach it before ~NanoReader() deletes the current one
+    chain->SetEntryList(0);
+    reader->fChain = 0;
+    delete reader;
+    delete chain;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,290 @@
+#ifndef ScoreSample_h
+#define ScoreSample_h
+
+#include "RocCurve.h"
+#include <Rtypes.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+// Unbinned scores of signal and background candidates, for an exact ROC.
+//
+// Record() keeps one (score, weight, label) record per candidate. Roc()
+// sorts them by decreasing score and sweeps the thresholds once: every
+// distinct score is a working point, so the curve is not limited by the
+// binning of a score histogram.
+//
+// Memory is bounded: past max_records the records are sorted (in parallel,
+// see Sort()) and written to a temporary file in spill_dir as a sorted run,
+// and Roc() merges the runs with the records still in memory. A record is
+// 12 bytes, so 1e8 electrons take 1.2 GB of disk and max_records * 12 bytes
+// of memory. The run files are unlinked as soon as they are created and go
+// away with the object.
+//
+//    ScoreSample sample("/scratch", 1 << 24);
+//    sample.Record(LowPtElectron_embeddedID[k], LowPtElectron_genPartFlav[k] == 1);
+//    ScoreRoc roc = sample.Roc({0.01, 0.1});
+//
+// The curve keeps a point whenever an efficiency moved by resolution since
+// the last kept one (and the last point), so it stays small for plotting;
+// the AUC and the working points are computed on every threshold.
+
+// signal efficiency at a background efficiency, as RocCurve::SignalEfficiencyAt()
+struct WorkingPoint
+{
+    double bkg_rate;
+    double sig_eff;
+    float  threshold;  // score >= threshold: the last threshold at or below bkg_rate
+};
+
+struct ScoreRoc
+{
+    RocCurve                  curve;
+    double                    auc = 0;
+    std::vector<WorkingPoint> points;
+    Long64_t                  n_records = 0;
+};
+
+class ScoreSample {
+public :
+    // one candidate; written to the runs as is
+    struct Record_t {
+        float score;
+        float weight;
+        Int_t signal;
+    };
+
+    ScoreSample(std::string spill_dir = "", Long64_t max_records = 1 << 24, int n_threads = 0)
+        : fDir(spill_dir), fMaxRecords(max_records < 1 ? 1 : max_records),
+          fThreads(n_threads > 0 ? n_threads : std::max(1u, std::thread::hardware_concurrency())),
+          fSignal(0), fBackground(0), fNaN(0), fSpilled(0)
+    {
+        if (fDir.empty())
+        {
+            const char *tmp = getenv("TMPDIR");
+            fDir = tmp ? tmp : "/tmp";
+        }
+    }
+    ScoreSample(const ScoreSample &) = delete;
+    ScoreSample &operator=(const ScoreSample &) = delete;
+    ~ScoreSample()
+    {
+        for (auto f : fRuns)
+        {
+            fclose(f);
+        }
+    }
+
+    void Record(float score, bool signal, float weight = 1)
+    {
+        // NaN has no place in the order
+        if (std::isnan(score))
+        {
+            ++fNaN;
+            return;
+        }
+        fRecords.push_back({score, weight, signal ? 1 : 0});
+        (signal ? fSignal : fBackground) += weight;
+        if ((Long64_t) fRecords.size() >= fMaxRecords)
+        {
+            Spill();
+        }
+    }
+
+    Long64_t Size() const { return fSpilled + (Long64_t) fRecords.size(); }
+
+    ScoreRoc Roc(std::vector<double> bkg_rates = {}, double resolution = 1e-4);
+
+private :
+    static bool Before(const Record_t &a, const Record_t &b) { return a.score > b.score; }
+
+    void Sort();
+    void Spill();
+
+    std::string           fDir;
+    Long64_t              fMaxRecords;
+    int                   fThreads;
+    std::vector<Record_t> fRecords;
+    double                fSignal;      // sum of weights
+    double                fBackground;
+    Long64_t              fNaN;
+    Long64_t              fSpilled;
+    std::vector<FILE*>    fRuns;        // sorted runs, unlinked
+};
+
+// Sort fRecords by decreasing score: fThreads parts sorted in parallel, then
+// merged pairwise.
+inline void ScoreSample::Sort()
+{
+    size_t n = fRecords.size();
+    int parts = (int) std::min<size_t>(fThreads, n / 65536 + 1);
+    std::vector<size_t> bounds;
+    for (int i = 0; i <= parts; ++i)
+    {
+        bounds.push_back(n * i / parts);
+    }
+    std::vector<std::thread> threads;
+    for (int i = 0; i < parts; ++i)
+    {
+        threads.push_back(std::thread([this, &bounds, i]() {
+            std::sort(fRecords.begin() + bounds[i], fRecords.begin() + bounds[i + 1], Before);
+        }));
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+    for (int width = 1; width < parts; width *= 2)
+    {
+        for (int i = 0; i + width < parts; i += 2 * width)
+        {
+            int last = std::min(i + 2 * width, parts);
+            std::inplace_merge(fRecords.begin() + bounds[i], fRecords.begin() + bounds[i + width],
+                               fRecords.begin() + bounds[last], Before);
+        }
+    }
+}
+
+// Write the records, sorted, as a new run and free the memory.
+inline void ScoreSample::Spill()
+{
+    Sort();
+    std::string path = fDir + "/ScoreSample-XXXXXX";
+    std::vector<char> name(path.begin(), path.end());
+    name.push_back(0);
+    int fd = mkstemp(name.data());
+    FILE *run = fd < 0 ? 0 : fdopen(fd, "w+b");
+    if (!run)
+    {
+        if (fd >= 0) close(fd);
+        // keep going in memory rather than lose records
+        printf("WARNING: ScoreSample: cannot create a run in %s, keeping %lld records in memory.\n", fDir.c_str(), (Long64_t) fRecords.size());
+        fMaxRecords *= 2;
+        return;
+    }
+    unlink(name.data());
+    if (fwrite(fRecords.data(), sizeof(Record_t), fRecords.size(), run) != fRecords.size())
+    {
+        printf("WARNING: ScoreSample: cannot write a run in %s, keeping %lld records in memory.\n", fDir.c_str(), (Long64_t) fRecords.size());
+        fclose(run);
+        fMaxRecords *= 2;
+        return;
+    }
+    fRuns.push_back(run);
+    fSpilled += fRecords.size();
+    fRecords.clear();
+    fRecords.shrink_to_fit();
+}
+
+// The curve, AUC and the signal efficiency at each of bkg_rates.
+inline ScoreRoc ScoreSample::Roc(std::vector<double> bkg_rates, double resolution)
+{
+    ScoreRoc roc;
+    roc.n_records = Size();
+    if (fNaN > 0)
+    {
+        printf("WARNING: ScoreSample: %lld records with a NaN score left out.\n", fNaN);
+    }
+    if (fSignal <= 0 || fBackground <= 0)
+    {
+        printf("ERROR: ScoreSample: no %s records.\n", fSignal <= 0 ? "signal" : "background");
+        return roc;
+    }
+    Sort();
+    std::sort(bkg_rates.begin(), bkg_rates.end());
+
+    // sources in decreasing score: the runs, read a block at a time, and the memory
+    const size_t kBlock = 1 << 16;
+    struct Source {
+        FILE                 *file;
+        std::vector<Record_t> block;
+        size_t                pos;
+    };
+    std::vector<Source> sources;
+    for (auto f : fRuns)
+    {
+        rewind(f);
+        sources.push_back({f, {}, 0});
+    }
+    sources.push_back({0, {}, 0});
+    auto next = [&](Source &s) -> const Record_t * {
+        if (!s.file)
+        {
+            return s.pos < fRecords.size() ? &fRecords[s.pos] : 0;
+        }
+        if (s.pos == s.block.size())
+        {
+            s.block.resize(kBlock);
+            s.block.resize(fread(s.block.data(), sizeof(Record_t), kBlock, s.file));
+            s.pos = 0;
+        }
+        return s.pos < s.block.size() ? &s.block[s.pos] : 0;
+    };
+    // highest score on top
+    auto lower = [&](int a, int b) { return next(sources[a])->score < next(sources[b])->score; };
+    std::priority_queue<int, std::vector<int>, decltype(lower)> heap(lower);
+    for (int i = 0; i < (int) sources.size(); ++i)
+    {
+        if (next(sources[i]))
+        {
+            heap.push(i);
+        }
+    }
+
+    // one pass over the thresholds; a threshold takes all records of its score
+    double sig = 0;
+    double bkg = 0;
+    double x0 = 0;            // previous threshold
+    double y0 = 0;
+    float  threshold0 = std::numeric_limits<float>::infinity();
+    double kept_x = 0;        // last point of the curve
+    double kept_y = 0;
+    size_t j = 0;
+    while (!heap.empty())
+    {
+        float score = next(sources[heap.top()])->score;
+        while (!heap.empty() && next(sources[heap.top()])->score == score)
+        {
+            int i = heap.top();
+            heap.pop();
+            const Record_t *r = next(sources[i]);
+            (r->signal ? sig : bkg) += r->weight;
+            ++sources[i].pos;
+            if (next(sources[i]))
+            {
+                heap.push(i);
+            }
+        }
+        double x = bkg / fBackground;
+        double y = sig / fSignal;
+        roc.auc += (x - x0) * (y + y0) / 2;
+        for (; j < bkg_rates.size() && x > bkg_rates[j]; ++j)
+        {
+            roc.points.push_back({bkg_rates[j], y0 + (y - y0) * (bkg_rates[j] - x0) / (x - x0), threshold0});
+        }
+        if (x - kept_x >= resolution || y - kept_y >= resolution || heap.empty())
+        {
+            roc.curve.fpr.push_back(x);
+            roc.curve.tpr.push_back(y);
+            kept_x = x;
+            kept_y = y;
+        }
+        x0 = x;
+        y0 = y;
+        threshold0 = score;
+    }
+    for (; j < bkg_rates.size(); ++j)
+    {
+        roc.points.push_back({bkg_rates[j], y0, threshold0});
+    }
+    return roc;
+}
+
+#endif
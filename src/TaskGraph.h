@@ -0,0 +1,125 @@
+#ifndef TaskGraph_h
+#define TaskGraph_h
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+// Post-loop work as a graph of tasks, each run once all the tasks it depends
+// on are done.
+//
+// Pool tasks (ROC curves, bootstrap bands, unbinned ROC merges) run on Run()'s
+// threads in any order. Main tasks run on the thread calling Run(), one at a
+// time: drawing and saving plots goes through gPad, gStyle and the list of
+// canvases of gROOT, which ROOT does not guard, and the printed tables keep
+// their lines together. A main task starts as soon as what it needs is done,
+// so plots of the histograms are drawn while the ROCs are still computed.
+//
+//    TaskGraph graph;
+//    TaskGraph::Task roc = graph.Add([&]() { curve = CumulativeRoc(sig, bkg); });
+//    graph.Add([&]() { DrawROC(curve, "Iron1"); }, {roc}, TaskGraph::kMain);
+//    graph.Run(8);
+//
+// Among the ready tasks of a kind the one added first runs first. The calling
+// thread also runs pool tasks while no main task is ready; with one thread it
+// runs everything, main tasks first.
+class TaskGraph {
+public :
+    typedef int Task;
+    enum Where { kPool, kMain };
+
+    // work, to run after the tasks of after (added before it, so there are no cycles)
+    Task Add(std::function<void()> work, std::vector<Task> after = {}, Where where = kPool)
+    {
+        Task t = fNodes.size();
+        fNodes.push_back({work, where, 0, {}});
+        for (Task a : after)
+        {
+            fNodes[a].next.push_back(t);
+            ++fNodes[t].waiting;
+        }
+        return t;
+    }
+
+    // run all tasks on n_threads threads (0: one per core), the calling one included
+    void Run(int n_threads = 0)
+    {
+        if (n_threads <= 0)
+        {
+            n_threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        fLeft = fNodes.size();
+        for (Task t = 0; t < (Task) fNodes.size(); ++t)
+        {
+            if (fNodes[t].waiting == 0)
+            {
+                fReady[fNodes[t].where].insert(t);
+            }
+        }
+        int n_pool = std::min<int>(n_threads - 1, fNodes.size());
+        std::vector<std::thread> pool;
+        for (int i = 0; i < n_pool; ++i)
+        {
+            pool.push_back(std::thread([this]() { Work(false); }));
+        }
+        Work(true);
+        for (auto &t : pool)
+        {
+            t.join();
+        }
+        fNodes.clear();
+    }
+
+private :
+    struct Node {
+        std::function<void()> work;
+        Where                 where;
+        int                   waiting;  // tasks still to be done before this one
+        std::vector<Task>     next;
+    };
+
+    void Work(bool main)
+    {
+        std::unique_lock<std::mutex> lock(fMutex);
+        while (true)
+        {
+            // the main thread takes main tasks first, pool threads only pool tasks
+            std::set<Task> *ready = 0;
+            fChanged.wait(lock, [&]() {
+                if (main && !fReady[kMain].empty()) ready = &fReady[kMain];
+                else if (!fReady[kPool].empty())   ready = &fReady[kPool];
+                return ready || fLeft == 0;
+            });
+            if (!ready)
+            {
+                return;
+            }
+            Task t = *ready->begin();
+            ready->erase(ready->begin());
+            lock.unlock();
+            fNodes[t].work();
+            lock.lock();
+            for (Task n : fNodes[t].next)
+            {
+                if (--fNodes[n].waiting == 0)
+                {
+                    fReady[fNodes[n].where].insert(n);
+                }
+            }
+            --fLeft;
+            fChanged.notify_all();
+        }
+    }
+
+    std::vector<Node>       fNodes;
+    std::set<Task>          fReady[2];
+    size_t                  fLeft;
+    std::mutex              fMutex;
+    std::condition_variable fChanged;
+};
+
+#endif
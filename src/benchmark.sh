@@ -0,0 +1,43 @@
+#!/bin/sh
+# Throughput benchmark of the compiled analyses on synthetic NanoAOD files
+# (see makeSynthetic.cxx), runnable without EOS access:
+#
+#   cmake --build build --target benchmark
+#   sh src/benchmark.sh build            # the same, by hand
+#
+# Settings, from the environment:
+#   BENCH_FILES        number of input files (default 2)
+#   BENCH_ENTRIES      events per file (default 100000)
+#   BENCH_COMPRESSION  ROOT compression settings (default 209, as NanoAOD)
+#   BENCH_MULT         makeSynthetic -m options, e.g. "-m nLowPtElectron=3"
+#
+# The files are kept in <build>/benchmark and reused while the settings are
+# the same. Results, one line per method, are appended to
+# <build>/benchmark/results.txt.
+
+build=${1:-build}
+files=${BENCH_FILES:-2}
+entries=${BENCH_ENTRIES:-100000}
+compression=${BENCH_COMPRESSION:-209}
+mult=${BENCH_MULT:-}
+work=$build/benchmark
+tag=$(echo "$entries c$compression $mult" | tr -c 'A-Za-z0-9=.\n' '_')
+mkdir -p "$work/inputs" "$work/plots"
+
+inputs=""
+i=0
+while [ $i -lt $files ]; do
+    f=$work/inputs/synthetic_${tag}_$i.root
+    if [ ! -f "$f" ]; then
+        "$build/makeSynthetic" -n "$entries" -c "$compression" -s $((i + 1)) $mult "$f" || exit 1
+    fi
+    inputs="$inputs $f"
+    i=$((i + 1))
+done
+
+echo "# $(date '+%F %T') files=$files entries=$entries compression=$compression $mult" >> "$work/results.txt"
+for run in "runNanoClass Loop" "runKUSU Loop" "runTTJETS Graph"; do
+    set -- $run
+    "$build/$1" "$2" "$work/plots/$1_$2" $inputs > "$work/$1_$2.log" 2>&1 || { echo "ERROR: $1 $2 failed, see $work/$1_$2.log"; exit 1; }
+    grep "^RunMain:" "$work/$1_$2.log" | tee -a "$work/results.txt"
+done
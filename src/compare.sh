@@ -0,0 +1,43 @@
+#!/bin/sh
+# Compare the outputs of two runs of the same method on the same inputs, file
+# by file, e.g. of the original macros and of the current executables:
+#
+#   sh src/compare.sh plots/baseline plots/current
+#
+# CSV and text files must be identical. PDFs are compared without their
+# /CreationDate and /ModDate entries, which ROOT sets to the time of the run.
+# One line is printed per file that differs or is on one side only; the exit
+# status is 1 if there is any.
+
+a=$1
+b=$2
+if [ ! -d "$a" ] || [ ! -d "$b" ]; then
+    echo "usage: sh src/compare.sh <dir_a> <dir_b>"
+    exit 2
+fi
+tmp=$(mktemp -d) || exit 2
+trap 'rm -rf "$tmp"' EXIT
+
+status=0
+files=$( { (cd "$a" && find . -type f); (cd "$b" && find . -type f); } | sort -u)
+for f in $files; do
+    if [ ! -f "$a/$f" ]; then
+        echo "only in $b: $f"
+        status=1
+        continue
+    fi
+    if [ ! -f "$b/$f" ]; then
+        echo "only in $a: $f"
+        status=1
+        continue
+    fi
+    case $f in
+        *.pdf)
+            LC_ALL=C grep -av '/CreationDate\|/ModDate' "$a/$f" > "$tmp/a"
+            LC_ALL=C grep -av '/CreationDate\|/ModDate' "$b/$f" > "$tmp/b"
+            cmp -s "$tmp/a" "$tmp/b" ;;
+        *)
+            cmp -s "$a/$f" "$b/$f" ;;
+    esac || { echo "differs: $f"; status=1; }
+done
+exit $status
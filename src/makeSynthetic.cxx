@@ -0,0 +1,207 @@
+// makeSynthetic: write a synthetic NanoAOD Events tree for the benchmarks.
+//
+//    makeSynthetic [options] <output.root>
+//
+//    -n <entries>          number of events (default 100000)
+//    -m <counter>=<mean>   mean multiplicity of a collection, e.g.
+//                          -m nLowPtElectron=2.5 (defaults: nLowPtElectron 2,
+//                          nGenPart 60); multiplicities are Poisson
+//    -c <settings>         ROOT compression settings, 100 * algorithm + level
+//                          (default 209, LZMA 9 as in NanoAOD; 505 is ZSTD 5,
+//                          404 LZ4 4, 101 ZLIB 1)
+//    -s <seed>             random seed (default 1)
+//
+// The branches are the leaves of NanoSchema.h, with the same names, types and
+// counters as in NanoAOD, so the analysis classes read the file like a real
+// sample. The values follow rough low pt electron distributions: enough for
+// every cut of the loops to pass some of the electrons, not for physics.
+#include <TFile.h>
+#include <TTree.h>
+#include <TRandom3.h>
+#include <TMath.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// Leaf buffers, one array per leaf of the schema.
+struct SyntheticBuffers {
+#define NANO_LEAF(type, name, capacity) type *name = 0;
+#include "NanoSchema.h"
+#undef NANO_LEAF
+};
+
+struct SyntheticColumn {
+    std::string name;
+    std::string counter;  // empty for event scalars and counters
+    std::function<void(Long64_t entry, std::map<std::string, int> &counts, TRandom3 &rng)> fill;
+};
+
+template <typename T> const char *LeafCode();
+template <> const char *LeafCode<Float_t>()   { return "F"; }
+template <> const char *LeafCode<Int_t>()     { return "I"; }
+template <> const char *LeafCode<UInt_t>()    { return "i"; }
+template <> const char *LeafCode<ULong64_t>() { return "l"; }
+template <> const char *LeafCode<Bool_t>()    { return "O"; }
+template <> const char *LeafCode<UChar_t>()   { return "b"; }
+
+// Value k of leaf name, for an event with n_gen generated particles.
+double SyntheticValue(const std::string &name, int k, int n_gen, TRandom3 &rng)
+{
+    std::string var = name.substr(name.find('_') + 1);
+    bool gen = name.compare(0, 8, "GenPart_") == 0;
+    if (var == "pt" || var == "ptbiased")      return 1.0 + rng.Exp(gen ? 15.0 : 4.0);
+    if (var == "eta")                          return gen ? rng.Gaus(0, 2.5) : rng.Uniform(-2.6, 2.6);
+    if (var == "phi")                          return rng.Uniform(-TMath::Pi(), TMath::Pi());
+    if (var == "mass")                         return gen ? rng.Exp(5.0) : 0.000511;
+    if (var == "dxy")                          return rng.Gaus(0, 0.02);
+    if (var == "dz")                           return rng.Gaus(0, 0.05);
+    if (var == "dxyErr")                       return 0.002 + rng.Exp(0.005);
+    if (var == "dzErr")                        return 0.004 + rng.Exp(0.010);
+    if (var == "ID" || var == "embeddedID" || var == "unbiased") return rng.Uniform(-4, 12);
+    if (var == "miniPFRelIso_all" || var == "miniPFRelIso_chg")  return rng.Exp(0.3);
+    if (var == "convVeto")                     return rng.Uniform() < 0.9;
+    if (var == "convWP")                       return int(rng.Uniform(4));
+    if (var == "convVtxRadius")                return rng.Exp(10.0);
+    if (var == "lostHits")                     return int(rng.Uniform(3));
+    if (var == "charge")                       return rng.Uniform() < 0.5 ? -1 : 1;
+    if (var == "status")                       return 1;
+    if (var == "statusFlags")                  return int(rng.Uniform(32768));
+    if (var == "genPartIdxMother")             return k == 0 ? -1 : int(rng.Uniform(k));
+    if (var == "genPartIdx")                   return (n_gen == 0 || rng.Uniform() < 0.5) ? -1 : int(rng.Uniform(n_gen));
+    if (var == "pdgId")
+    {
+        static const int ids[] = {1, 2, 3, 4, 5, 11, 13, 21, 22, 211};
+        int id = gen ? ids[int(rng.Uniform(10))] : 11;
+        return rng.Uniform() < 0.5 ? -id : id;
+    }
+    if (var == "genPartFlav")
+    {
+        // unmatched, prompt, b, tau, photon conversion
+        double u = rng.Uniform();
+        return u < 0.5 ? 0 : u < 0.7 ? 1 : u < 0.85 ? 5 : u < 0.9 ? 15 : 22;
+    }
+    return rng.Uniform();
+}
+
+template <typename T>
+void AddColumn(TTree *tree, std::vector<SyntheticColumn> &columns, const char *name, T *&buffer,
+               const std::map<std::string, int> &max_counts)
+{
+    std::string leaf = name;
+    std::string counter = "n" + leaf.substr(0, leaf.find('_'));
+    SyntheticColumn column;
+    column.name = leaf;
+    if (leaf.find('_') != std::string::npos && max_counts.count(counter))
+    {
+        column.counter = counter;
+        buffer = new T[max_counts.at(counter)]();
+        tree->Branch(name, buffer, (leaf + "[" + counter + "]/" + LeafCode<T>()).c_str());
+        column.fill = [buffer, leaf, counter](Long64_t, std::map<std::string, int> &counts, TRandom3 &rng)
+        {
+            int n = counts[counter];
+            int n_gen = counts.count("nGenPart") ? counts["nGenPart"] : 0;
+            for (int k = 0; k < n; ++k)
+            {
+                buffer[k] = T(SyntheticValue(leaf, k, n_gen, rng));
+            }
+        };
+    }
+    else
+    {
+        buffer = new T[1]();
+        tree->Branch(name, buffer, (leaf + "/" + LeafCode<T>()).c_str());
+        column.fill = [buffer, leaf](Long64_t entry, std::map<std::string, int> &counts, TRandom3 &)
+        {
+            if (counts.count(leaf))                 buffer[0] = T(counts[leaf]);
+            else if (leaf == "event")               buffer[0] = T(entry + 1);
+            else if (leaf == "luminosityBlock")     buffer[0] = T(1 + entry / 1000);
+            else                                    buffer[0] = T(1);
+        };
+    }
+    columns.push_back(column);
+}
+
+int main(int argc, char **argv)
+{
+    Long64_t entries = 100000;
+    int compression = 209;
+    UInt_t seed = 1;
+    std::map<std::string, double> means = {{"nLowPtElectron", 2.0}, {"nGenPart", 60.0}};
+    std::string output;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)      entries = atoll(argv[++i]);
+        else if (arg == "-c" && i + 1 < argc) compression = atoi(argv[++i]);
+        else if (arg == "-s" && i + 1 < argc) seed = atoi(argv[++i]);
+        else if (arg == "-m" && i + 1 < argc)
+        {
+            std::string m = argv[++i];
+            size_t eq = m.find('=');
+            if (eq == std::string::npos || !means.count(m.substr(0, eq)))
+            {
+                printf("ERROR: makeSynthetic: -m takes <counter>=<mean> for a counter of NanoSchema.h, not '%s'.\n", m.c_str());
+                return 1;
+            }
+            means[m.substr(0, eq)] = atof(m.substr(eq + 1).c_str());
+        }
+        else if (arg[0] != '-' && output.empty()) output = arg;
+        else
+        {
+            printf("usage: %s [-n entries] [-m counter=mean] [-c compression] [-s seed] <output.root>\n", argv[0]);
+            return 1;
+        }
+    }
+    if (output.empty())
+    {
+        printf("usage: %s [-n entries] [-m counter=mean] [-c compression] [-s seed] <output.root>\n", argv[0]);
+        return 1;
+    }
+
+    // multiplicities are cut at a generous tail, which sizes the arrays
+    std::map<std::string, int> max_counts;
+    for (const auto &m : means)
+    {
+        max_counts[m.first] = int(m.second + 6 * sqrt(m.second) + 8);
+    }
+
+    TFile *file = TFile::Open(output.c_str(), "RECREATE", "", compression);
+    if (!file || file->IsZombie())
+    {
+        printf("ERROR: makeSynthetic: cannot create %s.\n", output.c_str());
+        return 1;
+    }
+    TTree *tree = new TTree("Events", "Events");
+    SyntheticBuffers b;
+    std::vector<SyntheticColumn> columns;
+#define NANO_LEAF(type, name, capacity) AddColumn(tree, columns, #name, b.name, max_counts);
+#include "NanoSchema.h"
+#undef NANO_LEAF
+
+    TRandom3 rng(seed);
+    std::map<std::string, int> counts;
+    for (Long64_t entry = 0; entry < entries; ++entry)
+    {
+        for (const auto &m : means)
+        {
+            counts[m.first] = std::min(rng.Poisson(m.second), max_counts[m.first]);
+        }
+        for (auto &column : columns)
+        {
+            column.fill(entry, counts, rng);
+        }
+        tree->Fill();
+    }
+    tree->Write();
+    printf("makeSynthetic: wrote %lld events to %s (%.1f MB, compression %d).\n",
+           entries, output.c_str(), file->GetSize() / 1e6, compression);
+    file->Close();
+    delete file;
+    return 0;
+}
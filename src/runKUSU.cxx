@@ -0,0 +1,12 @@
+// runKUSU: compiled KUSU analysis, see RunMain.h.
+#include "KUSU.h"
+#include "RunMain.h"
+
+int main(int argc, char **argv)
+{
+    RunMethods<KUSU> methods = {
+        {"Loop",  [](KUSU &t, const RunOptions &o) { t.Loop(o.threads); }},
+        {"Loop2", [](KUSU &t, const RunOptions &o) { t.Loop2(); }},
+    };
+    return RunMain(argc, argv, methods);
+}
@@ -0,0 +1,11 @@
+// runNanoClass: compiled NanoClass analysis, see RunMain.h.
+#include "NanoClass.h"
+#include "RunMain.h"
+
+int main(int argc, char **argv)
+{
+    RunMethods<NanoClass> methods = {
+        {"Loop", [](NanoClass &t, const RunOptions &o) { t.Loop(); }},
+    };
+    return RunMain(argc, argv, methods);
+}
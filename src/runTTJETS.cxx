@@ -0,0 +1,16 @@
+// runTTJETS: compiled TTJETS analysis, see RunMain.h.
+#include "TTJETS.h"
+#include "RunMain.h"
+
+int main(int argc, char **argv)
+{
+    RunMethods<TTJETS> methods = {
+        {"RunAll", [](TTJETS &t, const RunOptions &o) { t.RunAll(); }},
+        {"Graph",  [](TTJETS &t, const RunOptions &o) { t.Graph("Final", 1.0, 20.0, "General"); }},
+        {"Loop2",  [](TTJETS &t, const RunOptions &o) { t.Loop2(); }},
+        {"Loop2Bootstrap", [](TTJETS &t, const RunOptions &o) { t.UseBootstrap(100); t.Loop2(); }},
+        {"Loop2Unbinned", [](TTJETS &t, const RunOptions &o) { t.UseUnbinnedRoc("", 512000000); t.Loop2(); }},
+        {"Random", [](TTJETS &t, const RunOptions &o) { t.Random(); }},
+    };
+    return RunMain(argc, argv, methods);
+}